@@ -236,6 +236,18 @@ float Aux::FastFabs(float x)
 
 // ------------------------------------------------------------------------------------------------------- //
 
+// Name:        Sqrt
+// Description: Computes the square root of a float number
+// Arguments:   x - The float number (must not be negative)
+// Returns:     The square root of the input number
+
+float Aux::Sqrt(float x)
+{
+    return sqrtf(x);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
 // Name:        Mean
 // Description: Computes the mean (average) of an array of unsigned 32-bit integers
 // Arguments:   Array - The array of unsigned 32-bit integers
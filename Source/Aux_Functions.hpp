@@ -96,6 +96,12 @@ class Aux
         // Returns:     The absolute value of the input number
         static float FastFabs(float x);
 
+        // Name:        Sqrt
+        // Description: Computes the square root of a float number
+        // Arguments:   x - The float number (must not be negative)
+        // Returns:     The square root of the input number
+        static float Sqrt(float x);
+
         // Name:        Mean
         // Description: Computes the mean (average) of an array of unsigned 32-bit integers
         // Arguments:   Array - The array of unsigned 32-bit integers
@@ -0,0 +1,366 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Cascaded biquad controller library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      BiquadCascade<N> implements a discrete transfer function of order up to 2N as N second-order
+//      sections in series. Each section uses the transposed Direct Form II:
+//          y  = B0 x + S1
+//          S1 = B1 x - A1 y + S2
+//          S2 = B2 x - A2 y
+//      which realizes H(z) = (B0 + B1 z^-1 + B2 z^-2) / (1 + A1 z^-1 + A2 z^-2).
+
+//      N is a template parameter, so coefficients and states are fixed-size arrays and the sample loop
+//      has a constant trip count the compiler can unroll: 5 multiply-accumulates per section.
+
+//      Used as a controller (Compute), the input is the error Ref - Y and the output goes through the
+//      limiter, like Lead. Used as a filter (Filter), the input is passed through unchanged.
+
+//      The Lead controller is the one-section case: Ut[k] = A Ut[k-1] + B E[k] + C E[k-1] is
+//      B0 = B, B1 = C, A1 = -A, B2 = A2 = 0 (see SetLead). Lag-lead, notch and PID with derivative
+//      filter designs are loaded the same way with SetSection.
+
+//      Usage example (lead followed by a notch):
+//          BiquadCascade<2> Loop;
+//          Loop.SetLead(0, A, B, C);
+//          Loop.SetSection(1, B0, B1, B2, A1, A2);
+//          Loop.SetLimits(-1, 1);
+//          float U = Loop.Compute(Y);
+
+//      Throughput on the host for 1 to 8 sections: SimBench::Biquad (see Sim_Bench.hpp).
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef BIQUAD_TIVAC_H_
+#define BIQUAD_TIVAC_H_
+
+// Templates must have C++ linkage
+#ifdef __cplusplus
+extern "C++"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// Second-order section coefficients (A0 = 1)
+typedef struct
+{
+    float B0;                   // Numerator - z^0
+    float B1;                   // Numerator - z^-1
+    float B2;                   // Numerator - z^-2
+    float A1;                   // Denominator - z^-1
+    float A2;                   // Denominator - z^-2
+} biquad_t;
+
+// Second-order section coefficients - Default values (pass-through)
+#define biquad_t_default { \
+    .B0 = 1, \
+    .B1 = 0, \
+    .B2 = 0, \
+    .A1 = 0, \
+    .A2 = 0, \
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+class BiquadCascade
+{
+    static_assert(N >= 1, "BiquadCascade needs at least one section");
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        biquad_t _Sec[N];           // Section coefficients
+        float _S1[N];               // Section states - First delay
+        float _S2[N];               // Section states - Second delay
+        float _Ref = 0;             // Setpoint
+        float _Ut_nxt = 0;          // Control action (sample k + 1)
+        float _Ut_min = 0;          // Minimum output value
+        float _Ut_max = 0;          // Maximum output value
+        bool _Saturated = false;    // Saturation flag
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        BiquadCascade
+        // Description: Constructor of the class - All sections pass-through, states cleared
+        // Arguments:   None
+        // Returns:     None
+        BiquadCascade();
+
+        // Name:        SetSection
+        // Description: Sets the coefficients of one section
+        // Arguments:   Idx - Index of the section
+        //              B0, B1, B2 - Numerator coefficients
+        //              A1, A2 - Denominator coefficients (A0 = 1)
+        // Returns:     None
+        void SetSection(uint8_t Idx, float B0, float B1, float B2, float A1, float A2);
+
+        // Name:        SetSection
+        // Description: Sets the coefficients of one section
+        // Arguments:   Idx - Index of the section
+        //              Coefs - Section coefficients
+        // Returns:     None
+        void SetSection(uint8_t Idx, const biquad_t *Coefs);
+
+        // Name:        GetSection
+        // Description: Gets the coefficients of one section
+        // Arguments:   Idx - Index of the section
+        //              Coefs - biquad_t struct to receive the coefficients
+        // Returns:     None
+        void GetSection(uint8_t Idx, biquad_t *Coefs);
+
+        // Name:        SetLead
+        // Description: Loads a Lead controller (Ut[k] = A Ut[k-1] + B E[k] + C E[k-1]) into one section
+        // Arguments:   Idx - Index of the section
+        //              A, B, C - Lead gains
+        // Returns:     None
+        void SetLead(uint8_t Idx, float A, float B, float C);
+
+        // Name:        SetReference
+        // Description: Sets the reference
+        // Arguments:   NewReference - The reference value
+        // Returns:     None
+        void SetReference(float NewReference);
+
+        // Name:        GetReference
+        // Description: Gets the reference
+        // Arguments:   None
+        // Returns:     The reference value
+        float GetReference();
+
+        // Name:        SetLimits
+        // Description: Sets the controller output limits
+        // Arguments:   Ut_min - Minimum output value
+        //              Ut_max - Maximum output value
+        // Returns:     None
+        void SetLimits(const float Ut_min, const float Ut_max);
+
+        // Name:        GetLimits
+        // Description: Gets the controller output limits
+        // Arguments:   Buffer - Buffer to receive the values
+        // Returns:     None
+        void GetLimits(float *Buffer);
+
+        // Name:        GetSaturated
+        // Description: Gets the saturation flag of the last sample
+        // Arguments:   None
+        // Returns:     True if the output was limited in the last sample
+        bool GetSaturated();
+
+        // Name:        Filter
+        // Description: Runs one sample through all sections (no reference, no limiter)
+        // Arguments:   X - Input sample
+        // Returns:     Output sample
+        float Filter(float X);
+
+        // Name:        Compute
+        // Description: Computes the control action
+        // Arguments:   Y - Current system output
+        // Returns:     The new control action
+        float Compute(float Y);
+
+        // Name:        Reset
+        // Description: Clears the section states (coefficients, reference and limits are kept)
+        // Arguments:   None
+        // Returns:     None
+        void Reset();
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+BiquadCascade<N>::BiquadCascade()
+{
+    const biquad_t PassThrough = biquad_t_default;
+
+    for (uint8_t Idx = 0; Idx < N; Idx++)
+        _Sec[Idx] = PassThrough;
+
+    Reset();
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void BiquadCascade<N>::SetSection(uint8_t Idx, float B0, float B1, float B2, float A1, float A2)
+{
+    if (Idx < N)
+    {
+        _Sec[Idx].B0 = B0;
+        _Sec[Idx].B1 = B1;
+        _Sec[Idx].B2 = B2;
+        _Sec[Idx].A1 = A1;
+        _Sec[Idx].A2 = A2;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void BiquadCascade<N>::SetSection(uint8_t Idx, const biquad_t *Coefs)
+{
+    if ((Idx < N) && (Coefs != nullptr))
+        _Sec[Idx] = *Coefs;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void BiquadCascade<N>::GetSection(uint8_t Idx, biquad_t *Coefs)
+{
+    if (Idx < N)
+        *Coefs = _Sec[Idx];
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void BiquadCascade<N>::SetLead(uint8_t Idx, float A, float B, float C)
+{
+    SetSection(Idx, B, C, 0, -A, 0);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void BiquadCascade<N>::SetReference(float NewReference)
+{
+    _Ref = NewReference;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+float BiquadCascade<N>::GetReference()
+{
+    return _Ref;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void BiquadCascade<N>::SetLimits(const float Ut_min, const float Ut_max)
+{
+    _Ut_min = Ut_min;
+    _Ut_max = Ut_max;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void BiquadCascade<N>::GetLimits(float *Buffer)
+{
+    Buffer[0] = _Ut_min;
+    Buffer[1] = _Ut_max;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+bool BiquadCascade<N>::GetSaturated()
+{
+    return _Saturated;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+inline float BiquadCascade<N>::Filter(float X)
+{
+    // Constant trip count - Unrolled by the compiler
+    for (uint8_t Idx = 0; Idx < N; Idx++)
+    {
+        const biquad_t &Sec = _Sec[Idx];
+
+        // Transposed Direct Form II
+        float Out = Sec.B0 * X + _S1[Idx];
+        _S1[Idx] = Sec.B1 * X - Sec.A1 * Out + _S2[Idx];
+        _S2[Idx] = Sec.B2 * X - Sec.A2 * Out;
+
+        // Output of this section is the input of the next one
+        X = Out;
+    }
+
+    return X;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+float BiquadCascade<N>::Compute(float Y)
+{
+    // Error - Sample k
+    _Ut_nxt = Filter(_Ref - Y);
+
+    // Limiter - Maximum output exceeded
+    if (_Ut_nxt >= _Ut_max)
+    {
+        _Ut_nxt = _Ut_max;
+        _Saturated = true;
+    }
+
+    // Limiter - Minimum output exceeded
+    else if (_Ut_nxt <= _Ut_min)
+    {
+        _Ut_nxt = _Ut_min;
+        _Saturated = true;
+    }
+
+    // Limiter - Between limits
+    else
+        _Saturated = false;
+
+    // Return calculated value
+    return _Ut_nxt;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void BiquadCascade<N>::Reset()
+{
+    for (uint8_t Idx = 0; Idx < N; Idx++)
+    {
+        _S1[Idx] = 0;
+        _S2[Idx] = 0;
+    }
+
+    _Ut_nxt = 0;
+    _Saturated = false;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
@@ -0,0 +1,306 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Cascade controller library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      Cascade<Stages...> chains Pid, Lead and Lqr controllers at compile time, outermost stage first.
+//      Each stage is a CascadeStage<Controller, Ratio>: the stage runs once every Ratio calls of
+//      Cascade::Compute and its output becomes the reference of the next (inner) stage. Between runs
+//      the inner stage keeps the last reference, so the whole cascade runs from one ISR at the rate of
+//      the innermost loop.
+
+//      The chain is resolved by templates: there are no virtual calls, no function pointers and no
+//      loops over stages, and every stage stores its controller by value. The stage glue is inlined
+//      into Cascade::Compute, but Pid, Lead and Lqr::Compute are defined in their own translation
+//      units, so each stage that runs still costs one direct call. Only link-time optimization
+//      (program-level optimization) can inline those bodies.
+
+//      Anti windup across stages: before an outer stage runs, its integral portion is held
+//      (Pid::SetHold, Lqr::SetHold in LQI mode) while the next inner stage is saturated, so the outer
+//      loop stops winding up against a limited inner loop. Lead stages have no integrator and ignore
+//      the hold.
+
+//      Measurements: Compute receives one measurement per stage, outermost first. Lqr stages use
+//      their own states (set with Lqr::SetState before Compute); their measurement is not used. The
+//      reference of an inner Lqr stage is written to state 0.
+
+//      Worst case: all stages run in the same call every LCM(Ratio) calls, starting on the first one.
+//      That call sets the worst-case cycle count of the ISR; the other calls only run a subset.
+
+//      Usage example (position 1 kHz -> velocity 10 kHz -> current 10 kHz):
+//          Cascade<CascadeStage<Pid, 10>, CascadeStage<Pid, 1>, CascadeStage<Pid, 1>> Loop;
+//          Loop.Get<0>().SetGains(...);
+//          ...
+//          float Y[3] = {Position, Velocity, Current};
+//          float Duty = Loop.Compute(Y);
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef CASCADE_TIVAC_H_
+#define CASCADE_TIVAC_H_
+
+// Templates must have C++ linkage
+#ifdef __cplusplus
+extern "C++"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// Controllers
+#include "Pid_TivaC.hpp"
+#include "Lead_TivaC.hpp"
+#include "Lqr_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototypes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Stage description - Controller type and decimation ratio
+template <typename Ctrl, uint16_t Ratio = 1>
+struct CascadeStage
+{
+    static_assert(Ratio >= 1, "CascadeStage ratio must be at least 1");
+
+    typedef Ctrl Controller;
+    static const uint16_t Decimation = Ratio;
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Uniform stage interface for the supported controllers
+class CascadeOps
+{
+    public:
+
+        // Name:        Compute
+        // Description: Computes the stage control action
+        // Arguments:   Controller - Stage controller
+        //              Y - Stage measurement (not used by Lqr)
+        // Returns:     The new control action
+        static inline float Compute(Pid &Controller, float Y) { return Controller.Compute(Y); }
+        static inline float Compute(Lead &Controller, float Y) { return Controller.Compute(Y); }
+        static inline float Compute(Lqr &Controller, float Y) { (void)Y; return Controller.Compute(); }
+
+        // Name:        SetReference
+        // Description: Sets the stage reference (state 0 for Lqr)
+        // Arguments:   Controller - Stage controller
+        //              Ref - Reference value
+        // Returns:     None
+        static inline void SetReference(Pid &Controller, float Ref) { Controller.SetReference(Ref); }
+        static inline void SetReference(Lead &Controller, float Ref) { Controller.SetReference(Ref); }
+        static inline void SetReference(Lqr &Controller, float Ref) { Controller.SetReference(0, Ref); }
+
+        // Name:        SetHold
+        // Description: Holds the stage integral portion (LQI integrator for Lqr, no effect on Lead)
+        // Arguments:   Controller - Stage controller
+        //              Hold - True to freeze the integral portion
+        // Returns:     None
+        static inline void SetHold(Pid &Controller, bool Hold) { Controller.SetHold(Hold); }
+        static inline void SetHold(Lead &Controller, bool Hold) { (void)Controller; (void)Hold; }
+        static inline void SetHold(Lqr &Controller, bool Hold) { Controller.SetHold(Hold); }
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Cascade of stages - Outermost stage first
+template <typename... Stages>
+class Cascade;
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Stage accessor - Walks the chain at compile time
+template <uint8_t Idx, typename... Stages>
+struct CascadeGet;
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Innermost stage
+template <typename Last>
+class Cascade<Last>
+{
+    template <uint8_t, typename...> friend struct CascadeGet;
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        typename Last::Controller _Ctrl;    // Stage controller
+        uint16_t _Tick = 0;                 // Decimation counter
+        float _Ut = 0;                      // Last control action
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Number of stages
+        static const uint8_t Count = 1;
+
+        // Name:        Get
+        // Description: Gets one stage controller (0 = outermost)
+        // Arguments:   None
+        // Returns:     Reference to the controller
+        template <uint8_t Idx>
+        typename CascadeGet<Idx, Last>::Controller &Get() { return CascadeGet<Idx, Last>::Get(*this); }
+
+        // Name:        Front
+        // Description: Gets the controller of the outermost stage of this chain
+        // Arguments:   None
+        // Returns:     Reference to the controller
+        typename Last::Controller &Front() { return _Ctrl; }
+
+        // Name:        GetSaturated
+        // Description: Gets the saturation flag of the outermost stage of this chain
+        // Arguments:   None
+        // Returns:     True if the stage output was limited in its last run
+        bool GetSaturated() { return _Ctrl.GetSaturated(); }
+
+        // Name:        Compute
+        // Description: Runs one tick of the chain
+        // Arguments:   Y - Measurements, one per stage, outermost first
+        // Returns:     The control action of the innermost stage
+        inline float Compute(const float *Y)
+        {
+            if (_Tick == 0)
+                _Ut = CascadeOps::Compute(_Ctrl, Y[0]);
+
+            if (++_Tick >= Last::Decimation)
+                _Tick = 0;
+
+            return _Ut;
+        }
+
+        // Name:        Reset
+        // Description: Restarts the decimation counters (controllers are not changed)
+        // Arguments:   None
+        // Returns:     None
+        void Reset()
+        {
+            _Tick = 0;
+            _Ut = 0;
+        }
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Outer stage followed by the inner chain
+template <typename First, typename... Rest>
+class Cascade<First, Rest...>
+{
+    template <uint8_t, typename...> friend struct CascadeGet;
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        typename First::Controller _Ctrl;   // Stage controller
+        Cascade<Rest...> _Inner;            // Inner chain
+        uint16_t _Tick = 0;                 // Decimation counter
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Number of stages
+        static const uint8_t Count = 1 + sizeof...(Rest);
+
+        // Name:        Get
+        // Description: Gets one stage controller (0 = outermost)
+        // Arguments:   None
+        // Returns:     Reference to the controller
+        template <uint8_t Idx>
+        typename CascadeGet<Idx, First, Rest...>::Controller &Get() { return CascadeGet<Idx, First, Rest...>::Get(*this); }
+
+        // Name:        Front
+        // Description: Gets the controller of the outermost stage of this chain
+        // Arguments:   None
+        // Returns:     Reference to the controller
+        typename First::Controller &Front() { return _Ctrl; }
+
+        // Name:        GetSaturated
+        // Description: Gets the saturation flag of the outermost stage of this chain
+        // Arguments:   None
+        // Returns:     True if the stage output was limited in its last run
+        bool GetSaturated() { return _Ctrl.GetSaturated(); }
+
+        // Name:        Compute
+        // Description: Runs one tick of the chain
+        // Arguments:   Y - Measurements, one per stage, outermost first
+        // Returns:     The control action of the innermost stage
+        inline float Compute(const float *Y)
+        {
+            if (_Tick == 0)
+            {
+                // Anti windup - Hold the integral portion while the inner stage is saturated
+                CascadeOps::SetHold(_Ctrl, _Inner.GetSaturated());
+
+                // Output of this stage is the reference of the inner stage
+                CascadeOps::SetReference(_Inner.Front(), CascadeOps::Compute(_Ctrl, Y[0]));
+            }
+
+            if (++_Tick >= First::Decimation)
+                _Tick = 0;
+
+            return _Inner.Compute(Y + 1);
+        }
+
+        // Name:        Reset
+        // Description: Restarts the decimation counters (controllers are not changed)
+        // Arguments:   None
+        // Returns:     None
+        void Reset()
+        {
+            _Tick = 0;
+            _Inner.Reset();
+        }
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Stage accessor - Index 0 is the front of the chain
+template <typename First, typename... Rest>
+struct CascadeGet<0, First, Rest...>
+{
+    typedef typename First::Controller Controller;
+
+    static inline Controller &Get(Cascade<First, Rest...> &Chain) { return Chain._Ctrl; }
+};
+
+// Stage accessor - Other indexes are looked up in the inner chain
+template <uint8_t Idx, typename First, typename... Rest>
+struct CascadeGet<Idx, First, Rest...>
+{
+    static_assert(Idx < 1 + sizeof...(Rest), "Cascade stage index out of range");
+
+    typedef typename CascadeGet<Idx - 1, Rest...>::Controller Controller;
+
+    static inline Controller &Get(Cascade<First, Rest...> &Chain) { return CascadeGet<Idx - 1, Rest...>::Get(Chain._Inner); }
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
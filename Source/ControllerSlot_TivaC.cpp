@@ -0,0 +1,164 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Controller slot library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Controller slot defines and macros
+#include "ControllerSlot_TivaC.hpp"
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Jump table entries
+// ------------------------------------------------------------------------------------------------------- //
+
+// Empty slot
+static float NoneCompute(void *Controller, float Y) { (void)Controller; (void)Y; return 0; }
+static void NonePreset(void *Controller, float Ut, float Y) { (void)Controller; (void)Ut; (void)Y; }
+static void NoneSetReference(void *Controller, float Ref) { (void)Controller; (void)Ref; }
+static bool NoneGetSaturated(void *Controller) { (void)Controller; return false; }
+
+// Pid
+static float PidCompute(void *Controller, float Y) { return ((Pid *)Controller)->Compute(Y); }
+static void PidPreset(void *Controller, float Ut, float Y) { ((Pid *)Controller)->Preset(Ut, Y); }
+static void PidSetReference(void *Controller, float Ref) { ((Pid *)Controller)->SetReference(Ref); }
+static bool PidGetSaturated(void *Controller) { return ((Pid *)Controller)->GetSaturated(); }
+
+// Lead
+static float LeadCompute(void *Controller, float Y) { return ((Lead *)Controller)->Compute(Y); }
+static void LeadPreset(void *Controller, float Ut, float Y) { ((Lead *)Controller)->Preset(Ut, Y); }
+static void LeadSetReference(void *Controller, float Ref) { ((Lead *)Controller)->SetReference(Ref); }
+static bool LeadGetSaturated(void *Controller) { return ((Lead *)Controller)->GetSaturated(); }
+
+// Lqr
+static float LqrCompute(void *Controller, float Y) { (void)Y; return ((Lqr *)Controller)->Compute(); }
+static void LqrPreset(void *Controller, float Ut, float Y) { ((Lqr *)Controller)->Preset(Ut, Y); }
+static void LqrSetReference(void *Controller, float Ref) { ((Lqr *)Controller)->SetReference(0, Ref); }
+static bool LqrGetSaturated(void *Controller) { return ((Lqr *)Controller)->GetSaturated(); }
+
+// Jump table - Same order as controller_type_t
+const controller_ops_t ControllerSlot::_Ops[CONTROLLER_TYPES] =
+{
+    {NoneCompute, NonePreset, NoneSetReference, NoneGetSaturated},
+    {PidCompute, PidPreset, PidSetReference, PidGetSaturated},
+    {LeadCompute, LeadPreset, LeadSetReference, LeadGetSaturated},
+    {LqrCompute, LqrPreset, LqrSetReference, LqrGetSaturated},
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        ControllerSlot
+// Description: Constructor of the class with no arguments
+// Arguments:   None
+// Returns:     None
+
+ControllerSlot::ControllerSlot()
+{
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _Select
+// Description: Selects a controller and presets it
+// Arguments:   Controller - Controller to be selected
+//              Type - Controller type
+//              Bumpless - True to preset the controller with the last output
+// Returns:     None
+
+void ControllerSlot::_Select(void *Controller, controller_type_t Type, bool Bumpless)
+{
+    // Empty slot
+    if (Controller == nullptr)
+        Type = CONTROLLER_NONE;
+
+    if (Bumpless)
+        _Ops[Type].Preset(Controller, _Ut, _Y);
+
+    _Ctrl = Controller;
+    _Type = Type;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Select
+// Description: Transfers the slot to a controller
+// Arguments:   Controller - Controller to be selected (nullptr = empty slot)
+//              Bumpless - True to preset the controller with the last output and measurement
+// Returns:     None
+
+void ControllerSlot::Select(Pid *Controller, bool Bumpless)
+{
+    _Select(Controller, CONTROLLER_PID, Bumpless);
+}
+
+void ControllerSlot::Select(Lead *Controller, bool Bumpless)
+{
+    _Select(Controller, CONTROLLER_LEAD, Bumpless);
+}
+
+void ControllerSlot::Select(Lqr *Controller, bool Bumpless)
+{
+    _Select(Controller, CONTROLLER_LQR, Bumpless);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetType
+// Description: Gets the type of the selected controller
+// Arguments:   None
+// Returns:     The controller type
+
+controller_type_t ControllerSlot::GetType()
+{
+    return _Type;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetReference
+// Description: Sets the reference of the selected controller (state 0 for Lqr)
+// Arguments:   Ref - The reference value
+// Returns:     None
+
+void ControllerSlot::SetReference(float Ref)
+{
+    _Ops[_Type].SetReference(_Ctrl, Ref);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetSaturated
+// Description: Gets the saturation flag of the selected controller
+// Arguments:   None
+// Returns:     True if the output was limited in the last sample
+
+bool ControllerSlot::GetSaturated()
+{
+    return _Ops[_Type].GetSaturated(_Ctrl);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetOutput
+// Description: Gets the last control action
+// Arguments:   None
+// Returns:     The last control action
+
+float ControllerSlot::GetOutput()
+{
+    return _Ut;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
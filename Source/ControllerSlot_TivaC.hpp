@@ -0,0 +1,175 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Controller slot library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      ControllerSlot holds one Pid, Lead or Lqr controller selected at run time and computes it
+//      through a constant jump table indexed by the controller type: no switch at the call sites, no
+//      virtual functions and no heap. The slot only keeps a pointer to the selected controller, so
+//      every controller keeps its own tuning while it is not selected.
+
+//      Select transfers the slot to another controller. With bumpless transfer (default) the incoming
+//      controller is preset (Pid::Preset, Lead::Preset, Lqr::Preset) with the last output of the slot
+//      and the last measurement, so its first output continues from where the outgoing one stopped.
+
+//      Lqr controllers use their own states (set with Lqr::SetState before Compute); the measurement
+//      passed to Compute is not used by them. Only an Lqr in LQI mode can absorb the transfer.
+
+//      The dispatch overhead against a direct call can be measured with SimHarness::Overhead.
+
+//      Usage example:
+//          ControllerSlot Slot;
+//          Slot.Select(&SpeedPid, false);
+//          ...
+//          if (Mode == MODE_POSITION) Slot.Select(&PositionLead);   // Bumpless
+//          float U = Slot.Compute(Y);
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef CONTROLLERSLOT_TIVAC_H_
+#define CONTROLLERSLOT_TIVAC_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// Controllers
+#include "Pid_TivaC.hpp"
+#include "Lead_TivaC.hpp"
+#include "Lqr_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Program enumerations
+// ------------------------------------------------------------------------------------------------------- //
+
+// Controller types - Jump table index
+typedef enum
+{
+    CONTROLLER_NONE,            // Empty slot - Output 0
+    CONTROLLER_PID,             // Pid
+    CONTROLLER_LEAD,            // Lead
+    CONTROLLER_LQR,             // Lqr
+    CONTROLLER_TYPES,           // Number of types
+} controller_type_t;
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// Controller operations - One jump table entry
+typedef struct
+{
+    float (*Compute)(void *Controller, float Y);            // Computes the control action
+    void (*Preset)(void *Controller, float Ut, float Y);    // Loads the internal state (bumpless)
+    void (*SetReference)(void *Controller, float Ref);      // Sets the reference (state 0 for Lqr)
+    bool (*GetSaturated)(void *Controller);                 // Gets the saturation flag
+} controller_ops_t;
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+class ControllerSlot
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        // Jump table - Indexed by controller_type_t
+        static const controller_ops_t _Ops[CONTROLLER_TYPES];
+
+        void *_Ctrl = nullptr;                      // Selected controller
+        controller_type_t _Type = CONTROLLER_NONE;  // Type of the selected controller
+        float _Ut = 0;                              // Last control action
+        float _Y = 0;                               // Last measurement
+
+        // Name:        _Select
+        // Description: Selects a controller and presets it
+        // Arguments:   Controller - Controller to be selected
+        //              Type - Controller type
+        //              Bumpless - True to preset the controller with the last output
+        // Returns:     None
+        void _Select(void *Controller, controller_type_t Type, bool Bumpless);
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        ControllerSlot
+        // Description: Constructor of the class with no arguments
+        // Arguments:   None
+        // Returns:     None
+        ControllerSlot();
+
+        // Name:        Select
+        // Description: Transfers the slot to a controller
+        // Arguments:   Controller - Controller to be selected (nullptr = empty slot)
+        //              Bumpless - True to preset the controller with the last output and measurement
+        // Returns:     None
+        void Select(Pid *Controller, bool Bumpless = true);
+        void Select(Lead *Controller, bool Bumpless = true);
+        void Select(Lqr *Controller, bool Bumpless = true);
+
+        // Name:        GetType
+        // Description: Gets the type of the selected controller
+        // Arguments:   None
+        // Returns:     The controller type
+        controller_type_t GetType();
+
+        // Name:        SetReference
+        // Description: Sets the reference of the selected controller (state 0 for Lqr)
+        // Arguments:   Ref - The reference value
+        // Returns:     None
+        void SetReference(float Ref);
+
+        // Name:        GetSaturated
+        // Description: Gets the saturation flag of the selected controller
+        // Arguments:   None
+        // Returns:     True if the output was limited in the last sample
+        bool GetSaturated();
+
+        // Name:        GetOutput
+        // Description: Gets the last control action
+        // Arguments:   None
+        // Returns:     The last control action
+        float GetOutput();
+
+        // Name:        Compute
+        // Description: Computes the control action of the selected controller
+        // Arguments:   Y - Measurement (not used by Lqr)
+        // Returns:     The new control action
+        inline float Compute(float Y)
+        {
+            _Y = Y;
+            _Ut = _Ops[_Type].Compute(_Ctrl, Y);
+
+            return _Ut;
+        }
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
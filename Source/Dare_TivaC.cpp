@@ -0,0 +1,537 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Discrete Riccati equation solver library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// DARE solver defines and macros
+#include "Dare_TivaC.hpp"
+
+// Standard libraries
+#include <stdint.h>
+
+// Drivers
+#include "driverlib/interrupt.h"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// True if X is neither NaN nor infinite
+#define DARE_FINITE(X) (((X) - (X)) == 0)
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Dare
+// Description: Constructor of the class with no arguments
+// Arguments:   None
+// Returns:     None
+
+Dare::Dare()
+{
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _RowW
+// Description: Computes one row of W = I + G H and copies the right-hand sides [A G]
+// Arguments:   Row - Row index
+// Returns:     None
+
+void Dare::_RowW(uint8_t Row)
+{
+    uint8_t Size = _Data.Size;
+
+    for (uint8_t Col = 0; Col < Size; Col++)
+    {
+        float Acc = (Row == Col) ? 1.0f : 0.0f;
+
+        for (uint8_t Idx = 0; Idx < Size; Idx++)
+            Acc += _Data.G[Row][Idx] * _Data.H[Idx][Col];
+
+        _Data.Aug[Row][Col] = Acc;
+        _Data.Aug[Row][Size + Col] = _Data.A[Row][Col];
+        _Data.Aug[Row][2 * Size + Col] = _Data.G[Row][Col];
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _Pivot
+// Description: Gauss-Jordan elimination of one column of [W | A G] with partial pivoting
+// Arguments:   Col - Pivot column
+// Returns:     False if W is singular or a non-finite value was found
+
+bool Dare::_Pivot(uint8_t Col)
+{
+    uint8_t Size = _Data.Size;
+    uint8_t Width = 3 * Size;
+
+    // Largest element of the column
+    uint8_t Pivot = Col;
+    float Max = 0;
+
+    for (uint8_t Row = Col; Row < Size; Row++)
+    {
+        float Abs = (_Data.Aug[Row][Col] < 0) ? -_Data.Aug[Row][Col] : _Data.Aug[Row][Col];
+
+        if (Abs > Max)
+        {
+            Max = Abs;
+            Pivot = Row;
+        }
+    }
+
+    if (!DARE_FINITE(Max) || (Max == 0))
+        return false;
+
+    // Row swap
+    if (Pivot != Col)
+    {
+        for (uint8_t Idx = Col; Idx < Width; Idx++)
+        {
+            float Tmp = _Data.Aug[Col][Idx];
+            _Data.Aug[Col][Idx] = _Data.Aug[Pivot][Idx];
+            _Data.Aug[Pivot][Idx] = Tmp;
+        }
+    }
+
+    // Pivot row normalization - One division per column
+    float Inv = 1.0f / _Data.Aug[Col][Col];
+
+    for (uint8_t Idx = Col; Idx < Width; Idx++)
+        _Data.Aug[Col][Idx] *= Inv;
+
+    // Elimination of the column in all other rows
+    for (uint8_t Row = 0; Row < Size; Row++)
+    {
+        float Factor = _Data.Aug[Row][Col];
+
+        if ((Row == Col) || (Factor == 0))
+            continue;
+
+        for (uint8_t Idx = Col; Idx < Width; Idx++)
+            _Data.Aug[Row][Idx] -= Factor * _Data.Aug[Col][Idx];
+    }
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _RowT
+// Description: Computes one row of T = Left X, X being one block of the solved right-hand sides
+// Arguments:   Row - Row index
+//              Left - Left factor (A or H)
+//              Offset - First column of X in Aug
+// Returns:     None
+
+void Dare::_RowT(uint8_t Row, float (*Left)[MAX_DARE_STATES], uint8_t Offset)
+{
+    uint8_t Size = _Data.Size;
+
+    for (uint8_t Col = 0; Col < Size; Col++)
+    {
+        float Acc = 0;
+
+        for (uint8_t Idx = 0; Idx < Size; Idx++)
+            Acc += Left[Row][Idx] * _Data.Aug[Idx][Offset + Col];
+
+        _Data.T[Row][Col] = Acc;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _RowG
+// Description: Computes one row of G = G + T A'
+// Arguments:   Row - Row index
+// Returns:     None
+
+void Dare::_RowG(uint8_t Row)
+{
+    uint8_t Size = _Data.Size;
+
+    for (uint8_t Col = 0; Col < Size; Col++)
+    {
+        float Acc = 0;
+
+        for (uint8_t Idx = 0; Idx < Size; Idx++)
+            Acc += _Data.T[Row][Idx] * _Data.A[Col][Idx];
+
+        _Data.G[Row][Col] += Acc;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _RowH
+// Description: Computes one row of H = H + A' T and updates the convergence measures
+// Arguments:   Row - Row index
+// Returns:     False if a non-finite value was found
+
+bool Dare::_RowH(uint8_t Row)
+{
+    uint8_t Size = _Data.Size;
+
+    for (uint8_t Col = 0; Col < Size; Col++)
+    {
+        float Delta = 0;
+
+        for (uint8_t Idx = 0; Idx < Size; Idx++)
+            Delta += _Data.A[Idx][Row] * _Data.T[Idx][Col];
+
+        float Value = _Data.H[Row][Col] + Delta;
+
+        if (!DARE_FINITE(Value))
+            return false;
+
+        _Data.H[Row][Col] = Value;
+
+        // Convergence measures
+        Delta = (Delta < 0) ? -Delta : Delta;
+        Value = (Value < 0) ? -Value : Value;
+
+        if (Delta > _Data.Delta)
+            _Data.Delta = Delta;
+
+        if (Value > _Data.Scale)
+            _Data.Scale = Value;
+    }
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _RowA
+// Description: Computes one row of A = A W^-1 A
+// Arguments:   Row - Row index
+// Returns:     None
+
+void Dare::_RowA(uint8_t Row)
+{
+    uint8_t Size = _Data.Size;
+    float Buffer[MAX_DARE_STATES];
+
+    // Row of the new A only depends on the same row of the old A
+    for (uint8_t Col = 0; Col < Size; Col++)
+    {
+        float Acc = 0;
+
+        for (uint8_t Idx = 0; Idx < Size; Idx++)
+            Acc += _Data.A[Row][Idx] * _Data.Aug[Idx][Size + Col];
+
+        Buffer[Col] = Acc;
+    }
+
+    for (uint8_t Col = 0; Col < Size; Col++)
+        _Data.A[Row][Col] = Buffer[Col];
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _Gain
+// Description: Computes K = (R + B' H B)^-1 B' H A from the converged H
+// Arguments:   None
+// Returns:     False if a non-finite value was found
+
+bool Dare::_Gain()
+{
+    uint8_t Size = _Data.Size;
+    float G[MAX_DARE_STATES];
+
+    // g = H B
+    for (uint8_t Row = 0; Row < Size; Row++)
+    {
+        float Acc = 0;
+
+        for (uint8_t Col = 0; Col < Size; Col++)
+            Acc += _Data.H[Row][Col] * _Data.B[Col];
+
+        G[Row] = Acc;
+    }
+
+    // s = R + B' g
+    float S = _Data.R;
+
+    for (uint8_t Row = 0; Row < Size; Row++)
+        S += _Data.B[Row] * G[Row];
+
+    if (!DARE_FINITE(S) || (S <= 0))
+        return false;
+
+    // K = (A' g)' / s
+    float Inv = 1.0f / S;
+
+    for (uint8_t Col = 0; Col < Size; Col++)
+    {
+        float Acc = 0;
+
+        for (uint8_t Row = 0; Row < Size; Row++)
+            Acc += _Data.A0[Row][Col] * G[Row];
+
+        _Data.K[Col] = Acc * Inv;
+
+        if (!DARE_FINITE(_Data.K[Col]))
+            return false;
+    }
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Init
+// Description: Loads the system and weights and starts the iteration
+// Arguments:   A - State matrix (Size x Size, row-major)
+//              B - Input vector (Size values)
+//              Q - State weight (Size x Size, row-major, symmetric positive semi-definite)
+//              R - Input weight (positive)
+//              Size - Number of states (1 to MAX_DARE_STATES)
+//              MaxIterations - Iteration limit
+//              Tolerance - Relative convergence tolerance (e.g. 1e-6)
+// Returns:     True if the problem was accepted, false otherwise
+
+bool Dare::Init(const float *A, const float *B, const float *Q, float R, uint8_t Size,
+                uint16_t MaxIterations, float Tolerance)
+{
+    _Data.State = DARE_IDLE;
+
+    if ((A == nullptr) || (B == nullptr) || (Q == nullptr))
+        return false;
+
+    if ((Size == 0) || (Size > MAX_DARE_STATES) || (R <= 0) || (Tolerance <= 0))
+        return false;
+
+    // A0 = A, G0 = B R^-1 B', H0 = Q
+    float Inv = 1.0f / R;
+
+    for (uint8_t Row = 0; Row < Size; Row++)
+    {
+        for (uint8_t Col = 0; Col < Size; Col++)
+        {
+            _Data.A0[Row][Col] = A[Row * Size + Col];
+            _Data.A[Row][Col] = A[Row * Size + Col];
+            _Data.G[Row][Col] = B[Row] * B[Col] * Inv;
+            _Data.H[Row][Col] = Q[Row * Size + Col];
+        }
+
+        _Data.B[Row] = B[Row];
+        _Data.K[Row] = 0;
+    }
+
+    _Data.R = R;
+    _Data.Size = Size;
+    _Data.Tolerance = Tolerance;
+    _Data.MaxIterations = MaxIterations;
+    _Data.Iterations = 0;
+    _Data.Delta = 0;
+    _Data.Scale = 0;
+    _Data.Row = 0;
+    _Data.Phase = DARE_PHASE_W;
+    _Data.State = DARE_RUNNING;
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Step
+// Description: Runs one slice of work
+// Arguments:   None
+// Returns:     The solver state
+
+dare_state_t Dare::Step()
+{
+    if (_Data.State != DARE_RUNNING)
+        return _Data.State;
+
+    uint8_t Size = _Data.Size;
+    uint8_t Row = _Data.Row;
+    bool Valid = true;
+
+    switch (_Data.Phase)
+    {
+        case DARE_PHASE_W:
+            _RowW(Row);
+            break;
+
+        case DARE_PHASE_PIVOT:
+            Valid = _Pivot(Row);
+            break;
+
+        case DARE_PHASE_T:
+            _RowT(Row, _Data.A, 2 * Size);
+            break;
+
+        case DARE_PHASE_G:
+            _RowG(Row);
+            break;
+
+        case DARE_PHASE_U:
+            _RowT(Row, _Data.H, Size);
+            break;
+
+        case DARE_PHASE_H:
+            Valid = _RowH(Row);
+            break;
+
+        case DARE_PHASE_A:
+            _RowA(Row);
+            break;
+
+        case DARE_PHASE_GAIN:
+            _Data.State = _Gain() ? DARE_DONE : DARE_FAILED;
+            return _Data.State;
+    }
+
+    if (!Valid)
+    {
+        _Data.State = DARE_FAILED;
+        return _Data.State;
+    }
+
+    // Next row of the same phase
+    if (++_Data.Row < Size)
+        return _Data.State;
+
+    _Data.Row = 0;
+
+    // H updated - Iteration completed
+    if (_Data.Phase == DARE_PHASE_H)
+    {
+        _Data.Iterations++;
+
+        if (_Data.Delta <= _Data.Tolerance * _Data.Scale)
+            _Data.Phase = DARE_PHASE_GAIN;
+
+        else if (_Data.Iterations >= _Data.MaxIterations)
+            _Data.State = DARE_FAILED;
+
+        else
+            _Data.Phase = DARE_PHASE_A;
+    }
+
+    // A updated - Next iteration
+    else if (_Data.Phase == DARE_PHASE_A)
+    {
+        _Data.Delta = 0;
+        _Data.Scale = 0;
+        _Data.Phase = DARE_PHASE_W;
+    }
+
+    else
+        _Data.Phase = (dare_phase_t)(_Data.Phase + 1);
+
+    return _Data.State;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Solve
+// Description: Runs slices until the solver stops (blocking)
+// Arguments:   None
+// Returns:     The solver state
+
+dare_state_t Dare::Solve()
+{
+    while (Step() == DARE_RUNNING);
+
+    return _Data.State;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetState
+// Description: Gets the solver state
+// Arguments:   None
+// Returns:     The solver state
+
+dare_state_t Dare::GetState()
+{
+    return _Data.State;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetIterations
+// Description: Gets the number of completed iterations
+// Arguments:   None
+// Returns:     Number of iterations
+
+uint16_t Dare::GetIterations()
+{
+    return _Data.Iterations;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetGains
+// Description: Gets the converged gain (zeros while running)
+// Arguments:   Buffer - Buffer to receive the gains (Size values)
+// Returns:     None
+
+void Dare::GetGains(float *Buffer)
+{
+    if (Buffer == nullptr)
+        return;
+
+    for (uint8_t Idx = 0; Idx < _Data.Size; Idx++)
+        Buffer[Idx] = _Data.K[Idx];
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetSolution
+// Description: Gets one element of the Riccati solution P (current iterate)
+// Arguments:   Row - Row index
+//              Col - Column index
+// Returns:     The element value
+
+float Dare::GetSolution(uint8_t Row, uint8_t Col)
+{
+    if ((Row < _Data.Size) && (Col < _Data.Size))
+        return _Data.H[Row][Col];
+
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Apply
+// Description: Writes the converged gain to a controller with interrupts disabled
+// Arguments:   Controller - Controller to be updated (Lqr::GetGainCount must equal Size)
+// Returns:     True if the gain was written, false if not converged or the gain count differs
+
+bool Dare::Apply(Lqr *Controller)
+{
+    if ((Controller == nullptr) || (_Data.State != DARE_DONE))
+        return false;
+
+    // A LQI controller would take a stale K[Size] as the integrator gain
+    if (Controller->GetGainCount() != _Data.Size)
+        return false;
+
+    // Returns true if interrupts were already disabled
+    bool Masked = IntMasterDisable();
+
+    Controller->SetGains(_Data.K);
+
+    if (!Masked)
+        IntMasterEnable();
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
@@ -0,0 +1,288 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Discrete Riccati equation solver library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      Computes the steady-state LQR gain of a discrete single-input system
+//          x[k + 1] = A x[k] + B u[k],    J = sum(x' Q x + R u^2)
+//      from the stabilizing solution P of the discrete algebraic Riccati equation (DARE):
+//          P = Q + A' P A - A' P B (R + B' P B)^-1 B' P A
+//          K = (R + B' P B)^-1 B' P A
+//      The gain follows the Lqr convention (u = K (Ref - x)), so it can be written to Lqr as is.
+
+//      P is found with the structured doubling algorithm. Starting from A0 = A, G0 = B R^-1 B' and
+//      H0 = Q, every iteration computes
+//          W = I + G H
+//          A <- A W^-1 A
+//          G <- G + A W^-1 G A'
+//          H <- H + A' H W^-1 A
+//      and H converges quadratically to P: iteration k is equivalent to 2^k steps of the plain Riccati
+//      recursion. The plain recursion is not used because, in single precision, its per-step change
+//      falls below the float resolution on weakly controllable systems long before it converges.
+
+//      The work is sliced so Step can run from the idle loop without disturbing the control ISR. One
+//      call does one row of one of the phases below, each O(n^2) operations (n = number of states):
+//          - W and the right-hand sides [A G]
+//          - Gauss-Jordan elimination of one pivot column of [W | A G]
+//          - A W^-1 G, then G update
+//          - H W^-1 A, then H update and convergence check
+//          - A update
+//      One iteration takes 7 n calls. The solver stops when no element of H changes by more than
+//      Tolerance times the largest element, computes K in one more call and sets DARE_DONE. It fails
+//      after MaxIterations, on a singular W or on a non-finite value.
+
+//      Apply copies the converged gain into a Lqr with interrupts disabled, so the control ISR never
+//      sees a partially written gain vector. It refuses a controller whose gain count is not Size.
+//      For a Lqr in LQI mode (Size + 1 gains) solve the augmented system, with the integrator as the
+//      last state:
+//          A_aug = [A 0; e_s' 1],    B_aug = [B; 0]      (e_s selects the integrated state)
+
+//      Usage example:
+//          Dare Solver;
+//          Solver.Init(&A[0][0], B, &Q[0][0], R, 4, 50, 1e-6f);
+//          while (Solver.Step() == DARE_RUNNING) { ... other idle work ... }
+//          Solver.Apply(&Controller);
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef DARE_TIVAC_H_
+#define DARE_TIVAC_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// LQR controller
+#include "Lqr_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#define MAX_DARE_STATES MAX_LQR_STATES  // Maximum number of states
+
+// ------------------------------------------------------------------------------------------------------- //
+// Program enumerations
+// ------------------------------------------------------------------------------------------------------- //
+
+// Solver states
+typedef enum
+{
+    DARE_IDLE,                  // Not initialized
+    DARE_RUNNING,               // Iterating
+    DARE_DONE,                  // Converged - Gain available
+    DARE_FAILED,                // Iteration limit reached, singular W or non-finite value
+} dare_state_t;
+
+// Solver phases - One row (or pivot) per Step call
+typedef enum
+{
+    DARE_PHASE_W,               // W = I + G H and right-hand sides [A G]
+    DARE_PHASE_PIVOT,           // Gauss-Jordan elimination of [W | A G]
+    DARE_PHASE_T,               // T = A W^-1 G
+    DARE_PHASE_G,               // G = G + T A'
+    DARE_PHASE_U,               // T = H W^-1 A
+    DARE_PHASE_H,               // H = H + A' T
+    DARE_PHASE_A,               // A = A W^-1 A
+    DARE_PHASE_GAIN,            // K from the converged H
+} dare_phase_t;
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// DARE solver variables
+typedef struct
+{
+    float A0[MAX_DARE_STATES][MAX_DARE_STATES];         // State matrix
+    float B[MAX_DARE_STATES];                           // Input vector
+    float R;                                            // Input weight
+    float A[MAX_DARE_STATES][MAX_DARE_STATES];          // Doubling A (iteration k)
+    float G[MAX_DARE_STATES][MAX_DARE_STATES];          // Doubling G (iteration k)
+    float H[MAX_DARE_STATES][MAX_DARE_STATES];          // Doubling H (iteration k) - Converges to P
+    float Aug[MAX_DARE_STATES][3 * MAX_DARE_STATES];    // [W | A G], then [I | W^-1 A  W^-1 G]
+    float T[MAX_DARE_STATES][MAX_DARE_STATES];          // Intermediate product
+    float K[MAX_DARE_STATES];                           // Gain
+    float Tolerance;                                    // Relative convergence tolerance
+    float Delta;                                        // Largest change of H in the current iteration
+    float Scale;                                        // Largest element of H in the current iteration
+    uint8_t Size;                                       // Number of states
+    uint8_t Row;                                        // Next row (or pivot column) of the phase
+    uint16_t Iterations;                                // Completed iterations
+    uint16_t MaxIterations;                             // Iteration limit
+    dare_phase_t Phase;                                 // Current phase
+    dare_state_t State;                                 // Solver state
+} dare_t;
+
+// DARE solver variables - Default values
+#define dare_t_default { \
+    .A0 = {{0}}, \
+    .B = {0}, \
+    .R = 0, \
+    .A = {{0}}, \
+    .G = {{0}}, \
+    .H = {{0}}, \
+    .Aug = {{0}}, \
+    .T = {{0}}, \
+    .K = {0}, \
+    .Tolerance = 0, \
+    .Delta = 0, \
+    .Scale = 0, \
+    .Size = 0, \
+    .Row = 0, \
+    .Iterations = 0, \
+    .MaxIterations = 0, \
+    .Phase = DARE_PHASE_W, \
+    .State = DARE_IDLE, \
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+class Dare
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        // Solver data
+        dare_t _Data = dare_t_default;
+
+        // Name:        _RowW
+        // Description: Computes one row of W = I + G H and copies the right-hand sides [A G]
+        // Arguments:   Row - Row index
+        // Returns:     None
+        void _RowW(uint8_t Row);
+
+        // Name:        _Pivot
+        // Description: Gauss-Jordan elimination of one column of [W | A G] with partial pivoting
+        // Arguments:   Col - Pivot column
+        // Returns:     False if W is singular or a non-finite value was found
+        bool _Pivot(uint8_t Col);
+
+        // Name:        _RowT
+        // Description: Computes one row of T = Left X, X being one block of the solved right-hand sides
+        // Arguments:   Row - Row index
+        //              Left - Left factor (A or H)
+        //              Offset - First column of X in Aug
+        // Returns:     None
+        void _RowT(uint8_t Row, float (*Left)[MAX_DARE_STATES], uint8_t Offset);
+
+        // Name:        _RowG
+        // Description: Computes one row of G = G + T A'
+        // Arguments:   Row - Row index
+        // Returns:     None
+        void _RowG(uint8_t Row);
+
+        // Name:        _RowH
+        // Description: Computes one row of H = H + A' T and updates the convergence measures
+        // Arguments:   Row - Row index
+        // Returns:     False if a non-finite value was found
+        bool _RowH(uint8_t Row);
+
+        // Name:        _RowA
+        // Description: Computes one row of A = A W^-1 A
+        // Arguments:   Row - Row index
+        // Returns:     None
+        void _RowA(uint8_t Row);
+
+        // Name:        _Gain
+        // Description: Computes K = (R + B' H B)^-1 B' H A from the converged H
+        // Arguments:   None
+        // Returns:     False if a non-finite value was found
+        bool _Gain();
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        Dare
+        // Description: Constructor of the class with no arguments
+        // Arguments:   None
+        // Returns:     None
+        Dare();
+
+        // Name:        Init
+        // Description: Loads the system and weights and starts the iteration
+        // Arguments:   A - State matrix (Size x Size, row-major)
+        //              B - Input vector (Size values)
+        //              Q - State weight (Size x Size, row-major, symmetric positive semi-definite)
+        //              R - Input weight (positive)
+        //              Size - Number of states (1 to MAX_DARE_STATES)
+        //              MaxIterations - Iteration limit
+        //              Tolerance - Relative convergence tolerance (e.g. 1e-6)
+        // Returns:     True if the problem was accepted, false otherwise
+        bool Init(const float *A, const float *B, const float *Q, float R, uint8_t Size,
+                  uint16_t MaxIterations, float Tolerance);
+
+        // Name:        Step
+        // Description: Runs one slice of work
+        // Arguments:   None
+        // Returns:     The solver state
+        dare_state_t Step();
+
+        // Name:        Solve
+        // Description: Runs slices until the solver stops (blocking)
+        // Arguments:   None
+        // Returns:     The solver state
+        dare_state_t Solve();
+
+        // Name:        GetState
+        // Description: Gets the solver state
+        // Arguments:   None
+        // Returns:     The solver state
+        dare_state_t GetState();
+
+        // Name:        GetIterations
+        // Description: Gets the number of completed iterations
+        // Arguments:   None
+        // Returns:     Number of iterations
+        uint16_t GetIterations();
+
+        // Name:        GetGains
+        // Description: Gets the converged gain (zeros while running)
+        // Arguments:   Buffer - Buffer to receive the gains (Size values)
+        // Returns:     None
+        void GetGains(float *Buffer);
+
+        // Name:        GetSolution
+        // Description: Gets one element of the Riccati solution P (current iterate)
+        // Arguments:   Row - Row index
+        //              Col - Column index
+        // Returns:     The element value
+        float GetSolution(uint8_t Row, uint8_t Col);
+
+        // Name:        Apply
+        // Description: Writes the converged gain to a controller with interrupts disabled
+        // Arguments:   Controller - Controller to be updated (Lqr::GetGainCount must equal Size)
+        // Returns:     True if the gain was written, false if not converged or the gain count differs
+        bool Apply(Lqr *Controller);
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
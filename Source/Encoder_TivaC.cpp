@@ -21,11 +21,17 @@
 // Standard libraries
 #include <stdint.h>
 
+// Execution time measurement (timestamps)
+#include "Wcet_TivaC.hpp"
+
 // TivaC device defines and macros
+#include "inc/hw_types.h"
+#include "inc/hw_timer.h"
 #include "driverlib/gpio.h"
 #include "driverlib/interrupt.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/qei.h"
+#include "driverlib/timer.h"
 
 // ------------------------------------------------------------------------------------------------------- //
 // Initialize the static array and counter
@@ -79,6 +85,34 @@ void Encoder::_InitHardware()
 
     // Enable the QEI
     QEIEnable(_Config.Hardware.BaseQEI);
+
+    // Edge capture not used
+    if (!_Config.Capture.Enable)
+        return;
+
+    // Enable peripheral clocks
+    SysCtlPeripheralEnable (_Config.Capture.PeriphTimer);
+    SysCtlPeripheralEnable (_Config.Capture.PeriphGPIO);
+
+    // Wait until last peripheral is ready
+    while(!SysCtlPeripheralReady (_Config.Capture.PeriphTimer));
+    while(!SysCtlPeripheralReady (_Config.Capture.PeriphGPIO));
+
+    // Unlock used pins
+    GPIOUnlockPin(_Config.Capture.BaseGPIO, _Config.Capture.PinA | _Config.Capture.PinB);
+
+    // Configure pins as capture inputs
+    GPIOPinTypeTimer(_Config.Capture.BaseGPIO, _Config.Capture.PinA | _Config.Capture.PinB);
+    GPIOPinConfigure(_Config.Capture.PinMuxA);
+    GPIOPinConfigure(_Config.Capture.PinMuxB);
+
+    // Both halves count up from 0 and latch the time of every edge of their phase - No interrupts
+    TimerConfigure(_Config.Capture.BaseTimer, TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_CAP_TIME_UP | TIMER_CFG_B_CAP_TIME_UP);
+    TimerControlEvent(_Config.Capture.BaseTimer, TIMER_BOTH, TIMER_EVENT_BOTH_EDGES);
+    TimerLoadSet(_Config.Capture.BaseTimer, TIMER_BOTH, 0xFFFFFFFF);
+
+    // Start both halves together - Common time base
+    TimerEnable(_Config.Capture.BaseTimer, TIMER_BOTH);
 }
 
 // ------------------------------------------------------------------------------------------------------- //
@@ -111,14 +145,159 @@ void Encoder::_IsrTimerVelHandler ()
     // Clear the interrupt that is generated
     QEIIntClear(_Config.Hardware.BaseQEI, QEIIntStatus(_Config.Hardware.BaseQEI, true));
 
-    // Get the position reading of the encoder
-    _Data.Pos = QEIPositionGet(_Config.Hardware.BaseQEI);
-
     // Get the number of quadrature ticks since last call
     _Data.Vel = QEIVelocityGet(_Config.Hardware.BaseQEI);
 
     // Get the direction reading of the encoder
     _Data.Dir = QEIDirectionGet(_Config.Hardware.BaseQEI);
+
+    uint32_t Pos_lst = _Data.Pos;
+
+    // Get the position reading and the speed of the encoder
+    if (_Config.Capture.Enable)
+        _UpdateSpeed();
+
+    else
+    {
+        _Data.Pos = QEIPositionGet(_Config.Hardware.BaseQEI);
+        _Data.Speed = (float)((int32_t)_Data.Vel * _Data.Dir) * (float)_Config.Params.ScanFreq;
+    }
+
+    // Multi-turn position
+    _Accumulate(Pos_lst);
+
+#if ENCODER_HISTORY_SIZE
+    // Sample history - Dropped and counted if the consumer fell behind
+    encoder_sample_t *Slot = _History.Reserve();
+
+    if (Slot != nullptr)
+    {
+        Slot->Time = Wcet::GetCycles();
+        Slot->Dir = _Data.Dir;
+        Slot->PosAbs = _Data.PosAbs;
+        Slot->Speed = _Data.Speed;
+        Slot->Vel = _Data.Vel;
+
+        _History.Commit();
+    }
+#endif
+
+    // Publish the scan to the readers
+    _Shared.Write(_Data);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _PosDelta
+// Description: Computes the shortest signed distance between two positions (wrap-aware, under half a turn)
+// Arguments:   Pos - New position
+//              Pos_lst - Old position
+// Returns:     Pos - Pos_lst (pulses)
+
+int32_t Encoder::_PosDelta(uint32_t Pos, uint32_t Pos_lst)
+{
+    // The QEI counts from 0 to PPR and wraps
+    int32_t Range = (int32_t)_Config.Params.PPR + 1;
+    int32_t Delta = (int32_t)(Pos - Pos_lst);
+
+    if (Delta > (Range / 2))
+        Delta -= Range;
+
+    else if (Delta < -(Range / 2))
+        Delta += Range;
+
+    return Delta;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _Accumulate
+// Description: Adds the movement since the last scan to the absolute position and revolution counter
+// Arguments:   Pos_lst - Position of the last scan
+// Returns:     None
+
+void Encoder::_Accumulate(uint32_t Pos_lst)
+{
+    int32_t Delta = _PosDelta(_Data.Pos, Pos_lst);
+
+    _Data.PosAbs += Delta;
+
+    // Less than half a turn per scan - At most one wrap
+    int32_t Raw = (int32_t)Pos_lst + Delta;
+
+    if (Raw > (int32_t)_Config.Params.PPR)
+        _Data.Turns++;
+
+    else if (Raw < 0)
+        _Data.Turns--;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _UpdateSpeed
+// Description: Reads the position and estimates the speed with the M/T method
+// Arguments:   None
+// Returns:     None
+
+void Encoder::_UpdateSpeed()
+{
+    uint32_t Base = _Config.Capture.BaseTimer;
+    uint32_t EdgeA, EdgeB, Pos, Now;
+    uint8_t Tries = ENCODER_MT_RETRIES;
+
+    // The position must be the one right after the last latched edge - Retry if an edge falls between the reads
+    do
+    {
+        EdgeA = TimerValueGet(Base, TIMER_A);
+        EdgeB = TimerValueGet(Base, TIMER_B);
+        Pos = QEIPositionGet(_Config.Hardware.BaseQEI);
+        Now = HWREG(Base + TIMER_O_TAV);
+    }
+    while (((EdgeA != TimerValueGet(Base, TIMER_A)) || (EdgeB != TimerValueGet(Base, TIMER_B))) && (--Tries != 0));
+
+    _Data.Pos = Pos;
+
+    int32_t Pulses = _PosDelta(Pos, _Mt.EdgePos);
+
+    // Movement - M pulses over the time between the last edges of this and of the previous scan with movement
+    if (Pulses != 0)
+    {
+        // Most recent edge of the two phases
+        uint32_t Edge = ((Now - EdgeA) < (Now - EdgeB)) ? EdgeA : EdgeB;
+        uint32_t Ticks = Edge - _Mt.EdgeTime;
+
+        // No reference edge (start or stopped) - Pulses per ScanFreq period
+        if (_Mt.Valid && (Ticks != 0))
+            _Data.Speed = (float)Pulses * _Mt.ClockFreq / (float)Ticks;
+
+        else
+            _Data.Speed = (float)Pulses * (float)_Config.Params.ScanFreq;
+
+        _Mt.EdgeTime = Edge;
+        _Mt.EdgePos = Pos;
+        _Mt.Valid = true;
+
+        return;
+    }
+
+    // No movement - The speed can not be higher than one pulse over the time since the last edge
+    uint32_t Elapsed = Now - _Mt.EdgeTime;
+
+    if (!_Mt.Valid || (Elapsed >= _Mt.Timeout))
+    {
+        _Data.Speed = 0;
+        _Mt.Valid = false;
+
+        return;
+    }
+
+    float Bound = _Mt.ClockFreq / (float)Elapsed;
+
+    if (_Data.Speed > Bound)
+        _Data.Speed = Bound;
+
+    else if (_Data.Speed < -Bound)
+        _Data.Speed = -Bound;
 }
 
 // ------------------------------------------------------------------------------------------------------- //
@@ -159,6 +338,11 @@ void Encoder::Init(const encoder_config_t *Config)
     // Copy config to a private variable
     _Config = *Config;
 
+    // M/T time base - The capture timer runs at the system clock
+    _Mt = encoder_mt_t_default;
+    _Mt.ClockFreq = (float)SysCtlClockGet();
+    _Mt.Timeout = (uint32_t)(_Mt.ClockFreq * (ENCODER_MT_TIMEOUT / 1000.0f));
+
     //  Initialize hardware
     _InitHardware();
 }
@@ -166,14 +350,30 @@ void Encoder::Init(const encoder_config_t *Config)
 // ------------------------------------------------------------------------------------------------------- //
 
 // Name:        GetData
-// Description: Gets all encoder data
+// Description: Gets all encoder data from the same scan (retries while the ISR overlaps the copy)
 // Arguments:   Buffer - encoder_data_t struct to receive data
 // Returns:     None
 
 void Encoder::GetData (encoder_data_t *Buffer)
 {
     if (Buffer != nullptr)
-        *Buffer = _Data;
+        _Shared.Read(Buffer);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        TryGetData
+// Description: Gets all encoder data from the same scan without waiting (for ISRs that can
+//              preempt the encoder ISR)
+// Arguments:   Buffer - encoder_data_t struct to receive data
+// Returns:     True if the data is complete, false if the encoder ISR was interrupted mid-write
+
+bool Encoder::TryGetData (encoder_data_t *Buffer)
+{
+    if (Buffer == nullptr)
+        return false;
+
+    return _Shared.TryRead(Buffer);
 }
 
 // ------------------------------------------------------------------------------------------------------- //
@@ -191,15 +391,76 @@ uint32_t Encoder::GetPos ()
 // ------------------------------------------------------------------------------------------------------- //
 
 // Name:        SetPos
-// Description: Sets encoder position
+// Description: Sets encoder position (the revolution counter is kept)
 // Arguments:   New encoder position
 // Returns:     None
 
 void Encoder::SetPos (uint32_t Pos)
 {
+    // The velocity ISR is the only other writer - Mask it while the data changes
+    QEIIntDisable(_Config.Hardware.BaseQEI, QEI_INTTIMER);
+
     // Set the position reading of the encoder
-     QEIPositionSet(_Config.Hardware.BaseQEI, Pos);
-     _Data.Pos =  Pos;
+    QEIPositionSet(_Config.Hardware.BaseQEI, Pos);
+    _Data.Pos =  Pos;
+    _Data.PosAbs = (int64_t)_Data.Turns * ((int64_t)_Config.Params.PPR + 1) + Pos;
+
+    // Move the M/T reference with the position - Not a movement
+    _Mt.EdgePos = Pos;
+
+    _Shared.Write(_Data);
+
+    QEIIntEnable(_Config.Hardware.BaseQEI, QEI_INTTIMER);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetPosAbs
+// Description: Gets encoder absolute position (tear-free)
+// Arguments:   None
+// Returns:     Encoder absolute position computed in last scan (pulses, multi-turn)
+
+int64_t Encoder::GetPosAbs ()
+{
+    // 64-bit reads are not atomic - Read through the snapshot
+    return _Shared.ReadField(&encoder_data_t::PosAbs);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetPosAbs
+// Description: Sets encoder absolute position (position and revolution counter)
+// Arguments:   New encoder absolute position (pulses, multi-turn)
+// Returns:     None
+
+void Encoder::SetPosAbs (int64_t PosAbs)
+{
+    int64_t Range = (int64_t)_Config.Params.PPR + 1;
+
+    // Floor division - Position always in [0, PPR]
+    int64_t Turns = PosAbs / Range;
+
+    if ((Turns * Range) > PosAbs)
+        Turns--;
+
+    // Mask the velocity ISR before the counter changes - SetPos enables it again
+    QEIIntDisable(_Config.Hardware.BaseQEI, QEI_INTTIMER);
+
+    _Data.Turns = (int32_t)Turns;
+
+    SetPos((uint32_t)(PosAbs - Turns * Range));
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetTurns
+// Description: Gets encoder revolution counter
+// Arguments:   None
+// Returns:     Encoder revolution counter computed in last scan
+
+int32_t Encoder::GetTurns ()
+{
+    return _Data.Turns;
 }
 
 // ------------------------------------------------------------------------------------------------------- //
@@ -228,3 +489,67 @@ int32_t Encoder::GetDir ()
 
 // ------------------------------------------------------------------------------------------------------- //
 
+// Name:        GetSpeed
+// Description: Gets encoder speed
+// Arguments:   None
+// Returns:     Encoder speed computed in last scan (pulses/s, signed)
+
+float Encoder::GetSpeed ()
+{
+    return _Data.Speed;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        DrainHistory
+// Description: Removes up to Max records from the sample history (oldest first)
+// Arguments:   Buffer - Buffer to receive the records
+//              Max - Buffer size (records)
+// Returns:     Number of records removed (always 0 with ENCODER_HISTORY_SIZE = 0)
+
+uint32_t Encoder::DrainHistory (encoder_sample_t *Buffer, uint32_t Max)
+{
+#if ENCODER_HISTORY_SIZE
+    if (Buffer != nullptr)
+        return _History.Drain(Buffer, Max);
+#else
+    (void)Buffer;
+    (void)Max;
+#endif
+
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetHistoryCount
+// Description: Gets the number of records waiting in the sample history
+// Arguments:   None
+// Returns:     Number of records
+
+uint32_t Encoder::GetHistoryCount ()
+{
+#if ENCODER_HISTORY_SIZE
+    return _History.GetCount();
+#else
+    return 0;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetHistoryDropped
+// Description: Gets the number of records dropped because the sample history was full
+// Arguments:   None
+// Returns:     Number of dropped records
+
+uint32_t Encoder::GetHistoryDropped ()
+{
+#if ENCODER_HISTORY_SIZE
+    return _History.GetDropped();
+#else
+    return 0;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------------- //
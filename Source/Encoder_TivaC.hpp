@@ -23,11 +23,25 @@ extern "C"
 // Standard libraries
 #include <stdint.h>
 
+// Sequence lock
+#include "Seqlock_TivaC.hpp"
+
+// SPSC ring buffer
+#include "Ring_TivaC.hpp"
+
 // ------------------------------------------------------------------------------------------------------- //
 // Definitions
 // ------------------------------------------------------------------------------------------------------- //
 
 #define MAX_ENCODERS 2              // Maximum number of encoder instances
+#define ENCODER_MT_TIMEOUT 1000     // Time without edges before the M/T speed is zero (ms)
+#define ENCODER_MT_RETRIES 3        // Attempts to read edge times and position without an edge between them
+
+// Sample history ring size (records, power of two) - 0: Disabled (no code generated)
+// Timestamps come from Wcet::GetCycles - Call Wcet::Init once at startup when enabled
+#ifndef ENCODER_HISTORY_SIZE
+#define ENCODER_HISTORY_SIZE 0
+#endif
 
 // ------------------------------------------------------------------------------------------------------- //
 // Structs
@@ -47,6 +61,22 @@ typedef struct
     uint32_t Config;                // QEI module configuration
 } encoder_hardware_t;
 
+// Edge capture configuration structure (M/T velocity)
+// Phases A and B are also wired to the two CCP pins of one wide timer (split pair, edge time mode),
+// which latches the time of the last edge on each phase
+typedef struct
+{
+    bool Enable;                    // M/T velocity enable (false = pulses per ScanFreq period only)
+    uint32_t PeriphTimer;           // Wide timer peripheral
+    uint32_t PeriphGPIO;            // GPIO peripheral
+    uint32_t BaseTimer;             // Wide timer base
+    uint32_t BaseGPIO;              // GPIO base
+    uint32_t PinMuxA;               // GPIO configuration A (timer A CCP)
+    uint32_t PinMuxB;               // GPIO configuration B (timer B CCP)
+    uint32_t PinA;                  // GPIO pin A
+    uint32_t PinB;                  // GPIO pin B
+} encoder_capture_t;
+
 // Encoder parameters structure
 typedef struct
 {
@@ -59,6 +89,7 @@ typedef struct
 {
     encoder_hardware_t Hardware;    // Hardware struct
     encoder_params_t Params;        // Parameters struct
+    encoder_capture_t Capture;      // Edge capture struct
 } encoder_config_t;
 
 // Encoder variables
@@ -67,6 +98,9 @@ typedef struct
    uint32_t Pos;                    // Position (pulses)
    uint32_t Vel;                    // Velocity (pulses per ScanFreq period)
    int32_t Dir;                     // Direction (1 = forward, -1 = backward)
+   float Speed;                     // Velocity (pulses/s, signed)
+   int64_t PosAbs;                  // Absolute position (pulses, multi-turn)
+   int32_t Turns;                   // Revolution counter (wraps of Pos)
 } encoder_data_t;
 
 // Encoder variables - Default values
@@ -74,6 +108,38 @@ typedef struct
     .Pos = 0, \
     .Vel = 0, \
     .Dir = 0, \
+    .Speed = 0, \
+    .PosAbs = 0, \
+    .Turns = 0, \
+}
+
+// Sample history record - 24 bytes
+typedef struct
+{
+    uint32_t Time;                  // Timestamp (cycles, wraps around)
+    int32_t Dir;                    // Direction (1 = forward, -1 = backward)
+    int64_t PosAbs;                 // Absolute position (pulses, multi-turn)
+    float Speed;                    // Velocity (pulses/s, signed)
+    uint32_t Vel;                   // Velocity (pulses per ScanFreq period)
+} encoder_sample_t;
+
+// M/T velocity variables
+typedef struct
+{
+    uint32_t EdgeTime;              // Time of the last edge of the last scan with movement (timer ticks)
+    uint32_t EdgePos;               // Position at that edge (pulses)
+    uint32_t Timeout;               // Time without edges before the speed is zero (timer ticks)
+    float ClockFreq;                // Timer clock frequency (Hz)
+    bool Valid;                     // EdgeTime valid flag
+} encoder_mt_t;
+
+// M/T velocity variables - Default values
+#define encoder_mt_t_default { \
+    .EdgeTime = 0, \
+    .EdgePos = 0, \
+    .Timeout = 0, \
+    .ClockFreq = 0, \
+    .Valid = false, \
 }
 
 // ------------------------------------------------------------------------------------------------------- //
@@ -97,9 +163,20 @@ class Encoder
         // Encoder configuration object
         encoder_config_t _Config;
 
-        // Encoder variables
+        // Encoder variables - Written by the velocity ISR only
         encoder_data_t _Data = encoder_data_t_default;
 
+        // Encoder variables - Snapshot published at the end of every scan
+        Seqlock<encoder_data_t> _Shared;
+
+#if ENCODER_HISTORY_SIZE
+        // Sample history - One record per scan
+        SpscRing<encoder_sample_t, ENCODER_HISTORY_SIZE> _History;
+#endif
+
+        // M/T velocity variables
+        encoder_mt_t _Mt = encoder_mt_t_default;
+
         // Name:        _InitHardware
         // Description: Starts device peripherals
         // Arguments:   None
@@ -118,6 +195,25 @@ class Encoder
         // Returns:     None
         void _IsrTimerVelHandler ();
 
+        // Name:        _PosDelta
+        // Description: Computes the shortest signed distance between two positions (wrap-aware, under half a turn)
+        // Arguments:   Pos - New position
+        //              Pos_lst - Old position
+        // Returns:     Pos - Pos_lst (pulses)
+        int32_t _PosDelta(uint32_t Pos, uint32_t Pos_lst);
+
+        // Name:        _Accumulate
+        // Description: Adds the movement since the last scan to the absolute position and revolution counter
+        // Arguments:   Pos_lst - Position of the last scan
+        // Returns:     None
+        void _Accumulate(uint32_t Pos_lst);
+
+        // Name:        _UpdateSpeed
+        // Description: Reads the position and estimates the speed with the M/T method
+        // Arguments:   None
+        // Returns:     None
+        void _UpdateSpeed();
+
     // --------------------------------------------------------------------------------------------------- //
     // Public members
     // --------------------------------------------------------------------------------------------------- //
@@ -143,11 +239,18 @@ class Encoder
         void Init(const encoder_config_t *Config);
 
         // Name:        GetData
-        // Description: Gets all encoder data
+        // Description: Gets all encoder data from the same scan (retries while the ISR overlaps the copy)
         // Arguments:   Buffer - encoder_data_t struct to receive data
         // Returns:     None
         void GetData (encoder_data_t *Buffer);
 
+        // Name:        TryGetData
+        // Description: Gets all encoder data from the same scan without waiting (for ISRs that can
+        //              preempt the encoder ISR)
+        // Arguments:   Buffer - encoder_data_t struct to receive data
+        // Returns:     True if the data is complete, false if the encoder ISR was interrupted mid-write
+        bool TryGetData (encoder_data_t *Buffer);
+
         // Name:        GetPos
         // Description: Gets encoder position
         // Arguments:   None
@@ -155,11 +258,29 @@ class Encoder
         uint32_t GetPos ();
 
         // Name:        SetPos
-        // Description: Sets encoder position
+        // Description: Sets encoder position (the revolution counter is kept)
         // Arguments:   New encoder position
         // Returns:     None
         void SetPos (uint32_t Pos);
 
+        // Name:        GetPosAbs
+        // Description: Gets encoder absolute position (tear-free)
+        // Arguments:   None
+        // Returns:     Encoder absolute position computed in last scan (pulses, multi-turn)
+        int64_t GetPosAbs ();
+
+        // Name:        SetPosAbs
+        // Description: Sets encoder absolute position (position and revolution counter)
+        // Arguments:   New encoder absolute position (pulses, multi-turn)
+        // Returns:     None
+        void SetPosAbs (int64_t PosAbs);
+
+        // Name:        GetTurns
+        // Description: Gets encoder revolution counter
+        // Arguments:   None
+        // Returns:     Encoder revolution counter computed in last scan
+        int32_t GetTurns ();
+
         // Name:        GetVel
         // Description: Gets encoder velocity
         // Arguments:   None
@@ -171,6 +292,31 @@ class Encoder
         // Arguments:   None
         // Returns:     Encoder direction read in last scan
         int32_t GetDir ();
+
+        // Name:        GetSpeed
+        // Description: Gets encoder speed
+        // Arguments:   None
+        // Returns:     Encoder speed computed in last scan (pulses/s, signed)
+        float GetSpeed ();
+
+        // Name:        DrainHistory
+        // Description: Removes up to Max records from the sample history (oldest first)
+        // Arguments:   Buffer - Buffer to receive the records
+        //              Max - Buffer size (records)
+        // Returns:     Number of records removed (always 0 with ENCODER_HISTORY_SIZE = 0)
+        uint32_t DrainHistory (encoder_sample_t *Buffer, uint32_t Max);
+
+        // Name:        GetHistoryCount
+        // Description: Gets the number of records waiting in the sample history
+        // Arguments:   None
+        // Returns:     Number of records
+        uint32_t GetHistoryCount ();
+
+        // Name:        GetHistoryDropped
+        // Description: Gets the number of records dropped because the sample history was full
+        // Arguments:   None
+        // Returns:     Number of dropped records
+        uint32_t GetHistoryDropped ();
 };
 
 // ------------------------------------------------------------------------------------------------------- //
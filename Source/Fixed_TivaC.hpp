@@ -0,0 +1,286 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Fixed-point arithmetic library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      This library provides the number traits used by the templated controllers (PidT, LeadT and
+//      LqrT). The same controller code runs with float, Q15 (q15_t) or Q31 (q31_t) numbers, so loops
+//      that run inside ISRs can avoid the FPU context save or run on parts with no FPU.
+
+//      Q15 values represent [-1, 1) with 15 fractional bits and Q31 values represent [-1, 1) with 31
+//      fractional bits. All fixed-point operations saturate instead of wrapping.
+
+//      Gains are scaled explicitly: a gain G with scale S represents the real value G * 2^S, so gains
+//      with magnitude above 1 can be represented (S = 0 to ScaleMax: 15 for Q15, 31 for Q31). Larger
+//      scales are limited to ScaleMax by FromFloat and by SetScale of the controllers; Mul runs in the
+//      sample path and does not check it. Products are kept in a wider accumulator (Acc) with headroom
+//      so partial sums do not overflow before the final saturation.
+
+//      Num<float> implements the same interface with plain float operations (the scale is ignored).
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef FIXED_TIVAC_H_
+#define FIXED_TIVAC_H_
+
+// Templates must have C++ linkage
+#ifdef __cplusplus
+extern "C++"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Fixed-point types (same definition used by CMSIS-DSP)
+typedef int16_t q15_t;              // Q15 number (1 sign bit, 15 fractional bits)
+typedef int32_t q31_t;              // Q31 number (1 sign bit, 31 fractional bits)
+
+// ------------------------------------------------------------------------------------------------------- //
+// Number traits
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Num
+// Description: Number traits - Specialized for each supported number type (float, q15_t, q31_t)
+// Arguments:   T - Number type
+template <typename T> struct Num;
+
+// Floating-point traits
+template <> struct Num<float>
+{
+    typedef float Acc;              // Accumulator type
+
+    static const uint8_t ScaleMax = 0xFF;   // Largest gain scale (the scale is ignored)
+
+    // Name:        FromFloat
+    // Description: Converts a float value to the number type
+    // Arguments:   Value - Value to be converted
+    //              Scale - Power of two scale of the value (ignored)
+    // Returns:     The converted value
+    static inline float FromFloat(float Value, uint8_t Scale) { (void)Scale; return Value; }
+
+    // Name:        ToFloat
+    // Description: Converts a value of the number type to float
+    // Arguments:   Value - Value to be converted
+    // Returns:     The converted value
+    static inline float ToFloat(float Value) { return Value; }
+
+    // Name:        Sub
+    // Description: Subtracts two values
+    // Arguments:   a - Minuend
+    //              b - Subtrahend
+    // Returns:     a - b
+    static inline float Sub(float a, float b) { return a - b; }
+
+    // Name:        Mul
+    // Description: Multiplies a scaled gain by a value
+    // Arguments:   Gain - Gain
+    //              Value - Value
+    //              Scale - Power of two scale of the gain (ignored)
+    // Returns:     Gain * Value
+    static inline float Mul(float Gain, float Value, uint8_t Scale) { (void)Scale; return Gain * Value; }
+
+    // Name:        Add
+    // Description: Adds two accumulator values
+    // Arguments:   a - First value
+    //              b - Second value
+    // Returns:     a + b
+    static inline float Add(float a, float b) { return a + b; }
+
+    // Name:        Sat
+    // Description: Converts an accumulator value to the number type
+    // Arguments:   Value - Accumulator value
+    // Returns:     The converted value
+    static inline float Sat(float Value) { return Value; }
+};
+
+// Q15 traits
+template <> struct Num<q15_t>
+{
+    typedef int32_t Acc;            // Accumulator type (Q15 with 14 bits of headroom)
+
+    static const int32_t AccMax = 0x1FFFFFFF;   // Largest accumulator magnitude
+    static const uint8_t ScaleMax = 15;         // Largest gain scale
+
+    // Name:        FromFloat
+    // Description: Converts a float value to Q15 with rounding and saturation
+    // Arguments:   Value - Value to be converted
+    //              Scale - Power of two scale of the value (limited to ScaleMax)
+    // Returns:     The converted value
+    static inline q15_t FromFloat(float Value, uint8_t Scale)
+    {
+        if (Scale > ScaleMax)
+            Scale = ScaleMax;
+
+        float Scaled = Value * (float)(1UL << (15 - Scale));
+        if (Scaled >= 32767.0f)
+            return 32767;
+        else if (Scaled <= -32768.0f)
+            return -32768;
+        return (q15_t)(Scaled + (Scaled < 0 ? -0.5f : 0.5f));
+    }
+
+    // Name:        ToFloat
+    // Description: Converts a Q15 value to float
+    // Arguments:   Value - Value to be converted
+    // Returns:     The converted value
+    static inline float ToFloat(q15_t Value) { return (float)Value * (1.0f / 32768.0f); }
+
+    // Name:        Sub
+    // Description: Subtracts two values with saturation
+    // Arguments:   a - Minuend
+    //              b - Subtrahend
+    // Returns:     a - b
+    static inline q15_t Sub(q15_t a, q15_t b) { return Sat((int32_t)a - (int32_t)b); }
+
+    // Name:        Mul
+    // Description: Multiplies a scaled gain by a value
+    // Arguments:   Gain - Gain
+    //              Value - Value
+    //              Scale - Power of two scale of the gain (0 to ScaleMax, not checked)
+    // Returns:     Gain * Value in the accumulator format, limited to the headroom
+    static inline int32_t Mul(q15_t Gain, q15_t Value, uint8_t Scale)
+    {
+        return Clamp(((int32_t)Gain * (int32_t)Value) >> (15 - Scale));
+    }
+
+    // Name:        Add
+    // Description: Adds two accumulator values
+    // Arguments:   a - First value
+    //              b - Second value
+    // Returns:     a + b, limited to the headroom
+    static inline int32_t Add(int32_t a, int32_t b) { return Clamp(a + b); }
+
+    // Name:        Sat
+    // Description: Converts an accumulator value to Q15 with saturation
+    // Arguments:   Value - Accumulator value
+    // Returns:     The converted value
+    static inline q15_t Sat(int32_t Value)
+    {
+        if (Value > 32767)
+            return 32767;
+        else if (Value < -32768)
+            return -32768;
+        return (q15_t)Value;
+    }
+
+    // Name:        Clamp
+    // Description: Limits an accumulator value to the accumulator headroom
+    // Arguments:   Value - Accumulator value
+    // Returns:     The limited value
+    static inline int32_t Clamp(int32_t Value)
+    {
+        if (Value > AccMax)
+            return AccMax;
+        else if (Value < -AccMax)
+            return -AccMax;
+        return Value;
+    }
+};
+
+// Q31 traits
+template <> struct Num<q31_t>
+{
+    typedef int64_t Acc;            // Accumulator type (Q31 with 30 bits of headroom)
+
+    static const int64_t AccMax = 0x1FFFFFFFFFFFFFFFLL; // Largest accumulator magnitude
+    static const uint8_t ScaleMax = 31;                 // Largest gain scale
+
+    // Name:        FromFloat
+    // Description: Converts a float value to Q31 with rounding and saturation
+    // Arguments:   Value - Value to be converted
+    //              Scale - Power of two scale of the value (limited to ScaleMax)
+    // Returns:     The converted value
+    static inline q31_t FromFloat(float Value, uint8_t Scale)
+    {
+        if (Scale > ScaleMax)
+            Scale = ScaleMax;
+
+        float Scaled = Value * (float)(1ULL << (31 - Scale));
+        if (Scaled >= 2147483647.0f)
+            return 2147483647;
+        else if (Scaled <= -2147483648.0f)
+            return (q31_t)0x80000000;
+        return (q31_t)(Scaled + (Scaled < 0 ? -0.5f : 0.5f));
+    }
+
+    // Name:        ToFloat
+    // Description: Converts a Q31 value to float
+    // Arguments:   Value - Value to be converted
+    // Returns:     The converted value
+    static inline float ToFloat(q31_t Value) { return (float)Value * (1.0f / 2147483648.0f); }
+
+    // Name:        Sub
+    // Description: Subtracts two values with saturation
+    // Arguments:   a - Minuend
+    //              b - Subtrahend
+    // Returns:     a - b
+    static inline q31_t Sub(q31_t a, q31_t b) { return Sat((int64_t)a - (int64_t)b); }
+
+    // Name:        Mul
+    // Description: Multiplies a scaled gain by a value
+    // Arguments:   Gain - Gain
+    //              Value - Value
+    //              Scale - Power of two scale of the gain (0 to ScaleMax, not checked)
+    // Returns:     Gain * Value in the accumulator format, limited to the headroom
+    static inline int64_t Mul(q31_t Gain, q31_t Value, uint8_t Scale)
+    {
+        return Clamp(((int64_t)Gain * (int64_t)Value) >> (31 - Scale));
+    }
+
+    // Name:        Add
+    // Description: Adds two accumulator values
+    // Arguments:   a - First value
+    //              b - Second value
+    // Returns:     a + b, limited to the headroom
+    static inline int64_t Add(int64_t a, int64_t b) { return Clamp(a + b); }
+
+    // Name:        Sat
+    // Description: Converts an accumulator value to Q31 with saturation
+    // Arguments:   Value - Accumulator value
+    // Returns:     The converted value
+    static inline q31_t Sat(int64_t Value)
+    {
+        if (Value > 2147483647LL)
+            return 2147483647;
+        else if (Value < -2147483648LL)
+            return (q31_t)0x80000000;
+        return (q31_t)Value;
+    }
+
+    // Name:        Clamp
+    // Description: Limits an accumulator value to the accumulator headroom
+    // Arguments:   Value - Accumulator value
+    // Returns:     The limited value
+    static inline int64_t Clamp(int64_t Value)
+    {
+        if (Value > AccMax)
+            return AccMax;
+        else if (Value < -AccMax)
+            return -AccMax;
+        return Value;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
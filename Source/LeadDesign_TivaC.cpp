@@ -0,0 +1,70 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Lead controller design library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Lead design defines and macros
+#include "LeadDesign_TivaC.hpp"
+
+// Standard libraries
+#include <stdint.h>
+#include <math.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        TustinRuntime
+// Description: Designs the Lead gains of K (s + Zero) / (s + Pole) at run time
+// Arguments:   Zero, Pole - Continuous zero and pole (rad/s)
+//              Gain - Continuous gain K
+//              Ts - Sample time (s)
+//              Wp - Prewarping frequency (rad/s, below pi / Ts; 0 = no prewarping)
+//              Gains - lead_gains_t struct to receive the gains
+// Returns:     None
+
+void LeadDesign::TustinRuntime(float Zero, float Pole, float Gain, float Ts, float Wp, lead_gains_t *Gains)
+{
+    // Tustin frequency scale
+    float Wc = (Wp > 0) ? Wp / tanf(0.5f * Wp * Ts) : 2.0f / Ts;
+
+    // Common denominator - The only other division
+    float Inv = 1.0f / (Wc + Pole);
+
+    Gains->A = (Wc - Pole) * Inv;
+    Gains->B = Gain * (Wc + Zero) * Inv;
+    Gains->C = Gain * (Zero - Wc) * Inv;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Retune
+// Description: Designs the Lead gains at run time and writes them to a controller
+// Arguments:   Controller - Controller to be updated
+//              Zero, Pole - Continuous zero and pole (rad/s)
+//              Gain - Continuous gain K
+//              Ts - Sample time (s)
+//              Wp - Prewarping frequency (rad/s, below pi / Ts; 0 = no prewarping)
+// Returns:     None
+
+void LeadDesign::Retune(Lead *Controller, float Zero, float Pole, float Gain, float Ts, float Wp)
+{
+    if (Controller == nullptr)
+        return;
+
+    lead_gains_t Gains;
+    TustinRuntime(Zero, Pole, Gain, Ts, Wp, &Gains);
+
+    Controller->SetGains(Gains.A, Gains.B, Gains.C);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
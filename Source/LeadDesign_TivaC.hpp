@@ -0,0 +1,210 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Lead controller design library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      Converts a continuous lead (or lag) compensator
+//          C(s) = K (s + Zero) / (s + Pole)                Zero, Pole in rad/s
+//      into the discrete gains of the Lead controller with the Tustin (bilinear) method:
+//          s = Wc (1 - z^-1) / (1 + z^-1)
+//          Wc = 2 / Ts                                     No prewarping
+//          Wc = Wp / tan(Wp Ts / 2)                        Prewarping at Wp (rad/s, exact match at Wp)
+//      which gives
+//          A = (Wc - Pole) / (Wc + Pole)
+//          B = K (Wc + Zero) / (Wc + Pole)
+//          C = K (Zero - Wc) / (Wc + Pole)
+
+//      Tustin and TustinBiquad are constexpr: with constant arguments the gains are computed by the
+//      compiler and nothing runs at boot. TustinRuntime and Retune do the same at run time for online
+//      changes, with the divisions done once per call, outside the sample path.
+
+//      Usage example (compile time, 10 kHz):
+//          constexpr lead_gains_t G = LeadDesign::Tustin(50.0, 500.0, 8.0, 1e-4);
+//          Lead Controller(G.A, G.B, G.C, 0, -1, 1);
+
+//      Usage example (run time, new sample time):
+//          LeadDesign::Retune(&Controller, 50.0f, 500.0f, 8.0f, NewTs, 0);
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef LEADDESIGN_TIVAC_H_
+#define LEADDESIGN_TIVAC_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// Lead controller
+#include "Lead_TivaC.hpp"
+
+// Cascaded biquad controller
+#include "Biquad_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#define LEAD_DESIGN_SERIES_TERMS 12     // Terms of the constexpr sine and cosine series
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// Lead controller gains
+typedef struct
+{
+    float A;                    // Gain A - Previous control action
+    float B;                    // Gain B - Error (sample k)
+    float C;                    // Gain C - Error (sample k - 1)
+} lead_gains_t;
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+class LeadDesign
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        // Name:        _SinSeries
+        // Description: Sine Taylor series, evaluated from the given term on (constexpr)
+        // Arguments:   X2 - Argument squared
+        //              Term - Current term
+        //              N - Index of the current term
+        // Returns:     Sum of the remaining terms
+        static constexpr double _SinSeries(double X2, double Term, uint8_t N)
+        {
+            return (N >= LEAD_DESIGN_SERIES_TERMS) ? Term :
+                Term + _SinSeries(X2, -Term * X2 / ((2.0 * N + 2.0) * (2.0 * N + 3.0)), N + 1);
+        }
+
+        // Name:        _CosSeries
+        // Description: Cosine Taylor series, evaluated from the given term on (constexpr)
+        // Arguments:   X2 - Argument squared
+        //              Term - Current term
+        //              N - Index of the current term
+        // Returns:     Sum of the remaining terms
+        static constexpr double _CosSeries(double X2, double Term, uint8_t N)
+        {
+            return (N >= LEAD_DESIGN_SERIES_TERMS) ? Term :
+                Term + _CosSeries(X2, -Term * X2 / ((2.0 * N + 1.0) * (2.0 * N + 2.0)), N + 1);
+        }
+
+        // Name:        _Tan
+        // Description: Tangent for |X| < pi / 2 (constexpr)
+        // Arguments:   X - Angle (rad)
+        // Returns:     tan(X)
+        static constexpr double _Tan(double X)
+        {
+            return _SinSeries(X * X, X, 0) / _CosSeries(X * X, 1.0, 0);
+        }
+
+        // Name:        _Warp
+        // Description: Tustin frequency scale (constexpr)
+        // Arguments:   Ts - Sample time (s)
+        //              Wp - Prewarping frequency (rad/s, 0 = no prewarping)
+        // Returns:     2 / Ts or Wp / tan(Wp Ts / 2)
+        static constexpr double _Warp(double Ts, double Wp)
+        {
+            return (Wp > 0) ? Wp / _Tan(Wp * Ts / 2.0) : 2.0 / Ts;
+        }
+
+        // Name:        _Gains
+        // Description: Tustin gains for a given frequency scale (constexpr)
+        // Arguments:   Zero, Pole - Continuous zero and pole (rad/s)
+        //              Gain - Continuous gain K
+        //              Wc - Tustin frequency scale
+        // Returns:     Lead gains
+        static constexpr lead_gains_t _Gains(double Zero, double Pole, double Gain, double Wc)
+        {
+            return lead_gains_t{(float)((Wc - Pole) / (Wc + Pole)),
+                                (float)(Gain * (Wc + Zero) / (Wc + Pole)),
+                                (float)(Gain * (Zero - Wc) / (Wc + Pole))};
+        }
+
+        // Name:        _Biquad
+        // Description: Maps Lead gains to one biquad section (constexpr)
+        // Arguments:   Gains - Lead gains
+        // Returns:     Section coefficients (B0 = B, B1 = C, A1 = -A)
+        static constexpr biquad_t _Biquad(lead_gains_t Gains)
+        {
+            return biquad_t{Gains.B, Gains.C, 0, -Gains.A, 0};
+        }
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        Tustin
+        // Description: Designs the Lead gains of K (s + Zero) / (s + Pole) (constexpr)
+        // Arguments:   Zero, Pole - Continuous zero and pole (rad/s)
+        //              Gain - Continuous gain K
+        //              Ts - Sample time (s)
+        //              Wp - Prewarping frequency (rad/s, below pi / Ts; 0 = no prewarping)
+        // Returns:     Lead gains
+        static constexpr lead_gains_t Tustin(double Zero, double Pole, double Gain, double Ts, double Wp = 0)
+        {
+            return _Gains(Zero, Pole, Gain, _Warp(Ts, Wp));
+        }
+
+        // Name:        TustinBiquad
+        // Description: Designs the same compensator as one BiquadCascade section (constexpr)
+        // Arguments:   Zero, Pole - Continuous zero and pole (rad/s)
+        //              Gain - Continuous gain K
+        //              Ts - Sample time (s)
+        //              Wp - Prewarping frequency (rad/s, below pi / Ts; 0 = no prewarping)
+        // Returns:     Section coefficients
+        static constexpr biquad_t TustinBiquad(double Zero, double Pole, double Gain, double Ts, double Wp = 0)
+        {
+            return _Biquad(Tustin(Zero, Pole, Gain, Ts, Wp));
+        }
+
+        // Name:        TustinRuntime
+        // Description: Designs the Lead gains of K (s + Zero) / (s + Pole) at run time
+        // Arguments:   Zero, Pole - Continuous zero and pole (rad/s)
+        //              Gain - Continuous gain K
+        //              Ts - Sample time (s)
+        //              Wp - Prewarping frequency (rad/s, below pi / Ts; 0 = no prewarping)
+        //              Gains - lead_gains_t struct to receive the gains
+        // Returns:     None
+        static void TustinRuntime(float Zero, float Pole, float Gain, float Ts, float Wp, lead_gains_t *Gains);
+
+        // Name:        Retune
+        // Description: Designs the Lead gains at run time and writes them to a controller
+        // Arguments:   Controller - Controller to be updated
+        //              Zero, Pole - Continuous zero and pole (rad/s)
+        //              Gain - Continuous gain K
+        //              Ts - Sample time (s)
+        //              Wp - Prewarping frequency (rad/s, below pi / Ts; 0 = no prewarping)
+        // Returns:     None
+        static void Retune(Lead *Controller, float Zero, float Pole, float Gain, float Ts, float Wp);
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
@@ -0,0 +1,263 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Templated lead controller library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      LeadT<T> implements the Lead control law (Ut[k+1] = A*Ut[k] + B*E[k] + C*E[k-1]) for any number
+//      type supported by Num<T> (float, q15_t or q31_t, see Fixed_TivaC.hpp).
+
+//      Gains share one power of two scale (see SetScale). Gains set with SetGainsFloat are converted
+//      once, outside the sample path. As in Lead, the fed back output is the value before the limiter.
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef LEADT_TIVAC_H_
+#define LEADT_TIVAC_H_
+
+// Templates must have C++ linkage
+#ifdef __cplusplus
+extern "C++"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// Number traits
+#include "Fixed_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+class LeadT
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        typedef typename Num<T>::Acc Acc;
+
+        T _Ref = 0;                 // Setpoint
+        T _E_now = 0;               // Error (sample k)
+        T _E_lst = 0;               // Error (sample k - 1)
+        T _Ut_nxt = 0;              // Control action - Total (sample k + 1)
+        T _Ut_now = 0;              // Control action - Total (sample k)
+        T _A = 0;                   // Gain A
+        T _B = 0;                   // Gain B
+        T _C = 0;                   // Gain C
+        uint8_t _Scale = 0;         // Gain scale (power of two)
+        T _Ut_min = 0;              // Minimum output value
+        T _Ut_max = 0;              // Maximum output value
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        SetScale
+        // Description: Sets the power of two scale shared by all gains
+        // Arguments:   Scale - Gain scale (gain real value = gain * 2^Scale, limited to Num<T>::ScaleMax)
+        // Returns:     None
+        void SetScale(uint8_t Scale);
+
+        // Name:        SetGains
+        // Description: Sets the controller gains (already scaled)
+        // Arguments:   A - A gain
+        //              B - B gain
+        //              C - C gain
+        // Returns:     None
+        void SetGains(const T A, const T B, const T C);
+
+        // Name:        SetGainsFloat
+        // Description: Sets the controller gains from real values using the current scale
+        // Arguments:   A - A gain
+        //              B - B gain
+        //              C - C gain
+        // Returns:     None
+        void SetGainsFloat(const float A, const float B, const float C);
+
+        // Name:        GetGains
+        // Description: Gets the controller gains (scaled)
+        // Arguments:   Buffer - Buffer to receive the values
+        // Returns:     None
+        void GetGains(T *Buffer);
+
+        // Name:        SetReference
+        // Description: Sets the reference
+        // Arguments:   NewReference - The reference value
+        // Returns:     None
+        void SetReference(T NewReference);
+
+        // Name:        GetReference
+        // Description: Gets the reference
+        // Arguments:   None
+        // Returns:     The reference value
+        T GetReference();
+
+        // Name:        SetLimits
+        // Description: Sets the controller output limits
+        // Arguments:   Ut_min - Minimum output value
+        //              Ut_max - Maximum output value
+        // Returns:     None
+        void SetLimits(const T Ut_min, const T Ut_max);
+
+        // Name:        GetLimits
+        // Description: Gets the controller output limits
+        // Arguments:   Buffer - Buffer to receive the values
+        // Returns:     None
+        void GetLimits(T *Buffer);
+
+        // Name:        Compute
+        // Description: Computes the control action
+        // Arguments:   Y - Current system output
+        // Returns:     The new control action
+        T Compute(T Y);
+
+        // Name:        Reset
+        // Description: Resets the controller state (gains, reference and limits are kept)
+        // Arguments:   None
+        // Returns:     None
+        void Reset();
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void LeadT<T>::SetScale(uint8_t Scale)
+{
+    if (Scale > Num<T>::ScaleMax)
+        Scale = Num<T>::ScaleMax;
+
+    _Scale = Scale;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void LeadT<T>::SetGains(const T A, const T B, const T C)
+{
+    _A = A;
+    _B = B;
+    _C = C;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void LeadT<T>::SetGainsFloat(const float A, const float B, const float C)
+{
+    SetGains(Num<T>::FromFloat(A, _Scale), Num<T>::FromFloat(B, _Scale), Num<T>::FromFloat(C, _Scale));
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void LeadT<T>::GetGains(T *Buffer)
+{
+    Buffer[0] = _A;
+    Buffer[1] = _B;
+    Buffer[2] = _C;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void LeadT<T>::SetReference(T NewReference)
+{
+    _Ref = NewReference;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+T LeadT<T>::GetReference()
+{
+    return _Ref;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void LeadT<T>::SetLimits(const T Ut_min, const T Ut_max)
+{
+    _Ut_min = Ut_min;
+    _Ut_max = Ut_max;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void LeadT<T>::GetLimits(T *Buffer)
+{
+    Buffer[0] = _Ut_min;
+    Buffer[1] = _Ut_max;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+T LeadT<T>::Compute(T Y)
+{
+    // Error - Sample k
+    _E_now = Num<T>::Sub(_Ref, Y);
+
+    // Total control action - Sample k + 1
+    _Ut_nxt = Num<T>::Sat(Num<T>::Add(Num<T>::Add(Num<T>::Mul(_A, _Ut_now, _Scale), Num<T>::Mul(_B, _E_now, _Scale)),
+                                      Num<T>::Mul(_C, _E_lst, _Scale)));
+
+    // Rotate buffers
+    _Ut_now = _Ut_nxt;
+    _E_lst = _E_now;
+
+    // Limiter - Maximum output exceeded
+    if (_Ut_nxt >= _Ut_max)
+    {
+        _Ut_nxt = _Ut_max;
+    }
+
+    // Limiter - Minimum output exceeded
+    else if (_Ut_nxt <= _Ut_min)
+    {
+        _Ut_nxt = _Ut_min;
+    }
+
+    // Return calculated value
+    return _Ut_nxt;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void LeadT<T>::Reset()
+{
+    _E_now = 0;
+    _E_lst = 0;
+    _Ut_nxt = 0;
+    _Ut_now = 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
@@ -18,6 +18,9 @@
 // Standard libraries
 #include <stdint.h>
 
+// Execution time measurement
+#include "Wcet_TivaC.hpp"
+
 // ------------------------------------------------------------------------------------------------------- //
 // Functions definitions
 // ------------------------------------------------------------------------------------------------------- //
@@ -133,6 +136,32 @@ void Lead::GetLimits(float *Buffer)
 
 // ------------------------------------------------------------------------------------------------------- //
 
+// Name:        GetSaturated
+// Description: Gets the saturation flag of the last sample
+// Arguments:   None
+// Returns:     True if the output was limited in the last sample
+
+bool Lead::GetSaturated()
+{
+    return _Data.Saturated;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetTelemetryId
+// Description: Sets the id written in the telemetry records of this controller and its ring
+// Arguments:   Id - Controller id
+//              Channel - Telemetry ring (0 to TELEMETRY_CHANNELS - 1, one per ISR priority)
+// Returns:     None
+
+void Lead::SetTelemetryId(uint8_t Id, uint8_t Channel)
+{
+    _TelemetryId = Id;
+    _TelemetryChannel = (Channel < TELEMETRY_CHANNELS) ? Channel : (TELEMETRY_CHANNELS - 1);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
 // Name:        Compute
 // Description: Computes the control action
 // Arguments:   Y - Current system output
@@ -140,6 +169,9 @@ void Lead::GetLimits(float *Buffer)
 
 float Lead::Compute(float Y)
 {
+    // Execution time measurement
+    WCET_SCOPE(WCET_LEAD);
+
     // Error - Sample k
     _Data.E_now = _Data.Ref - Y;
 
@@ -154,14 +186,24 @@ float Lead::Compute(float Y)
     if (_Data.Ut_nxt >= _Data.Ut_max)
     {
         _Data.Ut_nxt = _Data.Ut_max;
+        _Data.Saturated = true;
     }
 
     // Limiter - Minimum output exceeded
     else if (_Data.Ut_nxt <= _Data.Ut_min)
     {
         _Data.Ut_nxt = _Data.Ut_min;
+        _Data.Saturated = true;
     }
 
+    // Limiter - Between limits
+    else
+        _Data.Saturated = false;
+
+    // Telemetry tap
+    TELEMETRY_PUSH(TELEMETRY_LEAD, _TelemetryChannel, _TelemetryId, _Data.Saturated, _Data.E_now,
+                   0, 0, 0, _Data.Ut_nxt);
+
     // Return calculated value
     return _Data.Ut_nxt;  
 }
@@ -179,3 +221,25 @@ void Lead::Reset()
 }
 
 // ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Preset
+// Description: Loads the internal state so the next Compute continues from Ut (bumpless transfer)
+// Arguments:   Ut - Control action to continue from
+//              Y - Current measurement
+// Returns:     None
+
+void Lead::Preset(float Ut, float Y)
+{
+    _Data.E_now = _Data.Ref - Y;
+    _Data.Ut_now = Ut;
+    _Data.Ut_nxt = Ut;
+    _Data.Saturated = false;
+
+    // Previous error chosen so A Ut + B E + C E_lst = Ut for the same measurement (one division)
+    if (_Data.C != 0)
+        _Data.E_lst = ((1.0f - _Data.A) * Ut - _Data.B * _Data.E_now) / _Data.C;
+    else
+        _Data.E_lst = _Data.E_now;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
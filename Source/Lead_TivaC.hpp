@@ -23,6 +23,9 @@ extern "C"
 // Standard libraries
 #include <stdint.h>
 
+// Controller telemetry
+#include "Telemetry_TivaC.hpp"
+
 // ------------------------------------------------------------------------------------------------------- //
 // Definitions
 // ------------------------------------------------------------------------------------------------------- //
@@ -39,6 +42,7 @@ typedef struct
     float E_lst;                // Error (sample k - 1)
     float Ut_nxt;               // Control action - Total (sample k + 1)
     float Ut_now;               // Control action - Total (sample k)
+    bool Saturated;             // Saturation flag
     float A;                    // Gain A
     float B;                    // Gain B
     float C;                    // Gain C
@@ -53,6 +57,7 @@ typedef struct
     .E_lst = 0, \
     .Ut_nxt = 0, \
     .Ut_now = 0, \
+    .Saturated = false, \
     .A = 0, \
     .B = 0, \
     .C = 0, \
@@ -75,6 +80,10 @@ class Lead
         // Lead data
         lead_t _Data = lead_t_default;
 
+        // Telemetry id
+        uint8_t _TelemetryId = 0;
+        uint8_t _TelemetryChannel = 0;
+
     // --------------------------------------------------------------------------------------------------- //
     // Public members
     // --------------------------------------------------------------------------------------------------- //
@@ -137,6 +146,19 @@ class Lead
         // Returns:     None
         void GetLimits(float *Buffer);
 
+        // Name:        GetSaturated
+        // Description: Gets the saturation flag of the last sample
+        // Arguments:   None
+        // Returns:     True if the output was limited in the last sample
+        bool GetSaturated();
+
+        // Name:        SetTelemetryId
+        // Description: Sets the id written in the telemetry records of this controller and its ring
+        // Arguments:   Id - Controller id
+        //              Channel - Telemetry ring (0 to TELEMETRY_CHANNELS - 1, one per ISR priority)
+        // Returns:     None
+        void SetTelemetryId(uint8_t Id, uint8_t Channel = 0);
+
         // Name:        Compute
         // Description: Computes the control action
         // Arguments:   Y - Current system output
@@ -148,6 +170,13 @@ class Lead
         // Arguments:   None
         // Returns:     None
         void Reset();
+
+        // Name:        Preset
+        // Description: Loads the internal state so the next Compute continues from Ut (bumpless transfer)
+        // Arguments:   Ut - Control action to continue from
+        //              Y - Current measurement
+        // Returns:     None
+        void Preset(float Ut, float Y);
 };
 
 // ------------------------------------------------------------------------------------------------------- //
@@ -0,0 +1,431 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Multi-output LQR controller library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      LqrMimo<M, N> implements the state-feedback law Ut = K * (Ref - State) for M outputs and
+//      N states in one controller:
+//          - The error vector Ref - State is computed once per call and shared by all outputs
+//          - K is an M x N matrix stored row-major and aligned to LQR_MIMO_ALIGN bytes
+//          - The matrix-vector product is blocked by 4 rows: every error value is loaded once per
+//            block and feeds 4 independent accumulators
+//          - Every output has its own limits and saturation flag, like Lqr Ut_min / Ut_max
+
+//      Each output is summed in state order, so output i equals the Lqr result with row i of K.
+
+//      The states are set one by one, all at once (SetStates, Compute with a state vector) or written
+//      in place by an Observer attached to the state array (GetStateBuffer), like Lqr and LqrN.
+
+//      Usage example (2 actuators, 4 states):
+//          LqrMimo<2, 4> Loop;
+//          Loop.SetGains(&K[0][0]);
+//          Loop.SetLimits(0, -12.0f, 12.0f);
+//          Loop.SetLimits(1, -5.0f, 5.0f);
+//          ...
+//          float U[2];
+//          Loop.Compute(U);
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef LQRMIMO_TIVAC_H_
+#define LQRMIMO_TIVAC_H_
+
+// Templates must have C++ linkage
+#ifdef __cplusplus
+extern "C++"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Alignment of the gain matrix (bytes)
+#ifndef LQR_MIMO_ALIGN
+#define LQR_MIMO_ALIGN 32
+#endif
+
+#define LQR_MIMO_BLOCK 4                // Rows per block of the matrix-vector kernel
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+class LqrMimo
+{
+    static_assert((M >= 1) && (M <= 32), "LqrMimo supports 1 to 32 outputs");
+    static_assert(N >= 1, "LqrMimo needs at least one state");
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        alignas(LQR_MIMO_ALIGN) float _K[M][N] = {{0}};   // Gain matrix (row-major)
+        float _Ref[N] = {0};                            // Setpoint
+        float _State[N] = {0};                          // State values (sample k)
+        float _E[N] = {0};                              // Error (sample k)
+        float _Ut_nxt[M] = {0};                         // Control actions (sample k + 1)
+        float _Ut_min[M] = {0};                         // Minimum output values
+        float _Ut_max[M] = {0};                         // Maximum output values
+        uint32_t _Saturated = 0;                        // Saturation flags (bit i = output i)
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        SetGain
+        // Description: Sets one gain
+        // Arguments:   Output - Index of the output (row)
+        //              StateIndex - Index of the state (column)
+        //              NewGain - The gain value
+        // Returns:     None
+        void SetGain(uint8_t Output, uint8_t StateIndex, float NewGain);
+
+        // Name:        SetGains
+        // Description: Sets the whole gain matrix
+        // Arguments:   Gains - M x N gains, row-major
+        // Returns:     None
+        void SetGains(const float *Gains);
+
+        // Name:        GetGain
+        // Description: Gets one gain
+        // Arguments:   Output - Index of the output (row)
+        //              StateIndex - Index of the state (column)
+        // Returns:     The gain value
+        float GetGain(uint8_t Output, uint8_t StateIndex);
+
+        // Name:        SetReference
+        // Description: Sets the reference associated to one state
+        // Arguments:   StateIndex - Index of the state associated with the new value
+        //              NewReference - The reference value
+        // Returns:     None
+        void SetReference(uint8_t StateIndex, float NewReference);
+
+        // Name:        GetReference
+        // Description: Gets the reference associated to one state
+        // Arguments:   StateIndex - Index of the state associated with the new value
+        // Returns:     The reference value
+        float GetReference(uint8_t StateIndex);
+
+        // Name:        SetState
+        // Description: Sets the value of one state
+        // Arguments:   StateIndex - Index of the state
+        //              NewState - The state value
+        // Returns:     None
+        void SetState(uint8_t StateIndex, float NewState);
+
+        // Name:        SetStates
+        // Description: Sets the values of all states
+        // Arguments:   States - The state vector (N values)
+        // Returns:     None
+        void SetStates(const float *States);
+
+        // Name:        GetState
+        // Description: Gets the value of one state
+        // Arguments:   StateIndex - Index of the state
+        // Returns:     The state value
+        float GetState(uint8_t StateIndex);
+
+        // Name:        GetStateBuffer
+        // Description: Gets the state array, so an observer can write its estimate in place
+        // Arguments:   None
+        // Returns:     Pointer to the state values (N values)
+        float *GetStateBuffer();
+
+        // Name:        SetLimits
+        // Description: Sets the limits of one output
+        // Arguments:   Output - Index of the output
+        //              Ut_min - Minimum output value
+        //              Ut_max - Maximum output value
+        // Returns:     None
+        void SetLimits(uint8_t Output, const float Ut_min, const float Ut_max);
+
+        // Name:        GetLimits
+        // Description: Gets the limits of one output
+        // Arguments:   Output - Index of the output
+        //              Buffer - Buffer to receive the values
+        // Returns:     None
+        void GetLimits(uint8_t Output, float *Buffer);
+
+        // Name:        GetSaturated
+        // Description: Gets the saturation flag of one output in the last sample
+        // Arguments:   Output - Index of the output
+        // Returns:     True if the output was limited in the last sample
+        bool GetSaturated(uint8_t Output);
+
+        // Name:        GetSaturatedMask
+        // Description: Gets the saturation flags of all outputs in the last sample
+        // Arguments:   None
+        // Returns:     Saturation flags (bit i = output i)
+        uint32_t GetSaturatedMask();
+
+        // Name:        GetOutput
+        // Description: Gets one control action of the last sample
+        // Arguments:   Output - Index of the output
+        // Returns:     The control action
+        float GetOutput(uint8_t Output);
+
+        // Name:        Compute
+        // Description: Computes all control actions
+        // Arguments:   Ut - Buffer to receive the M control actions (may be nullptr, see GetOutput)
+        // Returns:     None
+        void Compute(float *Ut);
+
+        // Name:        Compute
+        // Description: Sets the values of all states and computes all control actions
+        //              (two arguments, so a state array is never taken for the output buffer)
+        // Arguments:   States - The state vector (N values)
+        //              Ut - Buffer to receive the M control actions (may be nullptr, see GetOutput)
+        // Returns:     None
+        void Compute(const float *States, float *Ut);
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+void LqrMimo<M, N>::SetGain(uint8_t Output, uint8_t StateIndex, float NewGain)
+{
+    if ((Output < M) && (StateIndex < N))
+        _K[Output][StateIndex] = NewGain;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+void LqrMimo<M, N>::SetGains(const float *Gains)
+{
+    for (uint8_t Row = 0; Row < M; Row++)
+        for (uint8_t Col = 0; Col < N; Col++)
+            _K[Row][Col] = Gains[Row * N + Col];
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+float LqrMimo<M, N>::GetGain(uint8_t Output, uint8_t StateIndex)
+{
+    if ((Output < M) && (StateIndex < N))
+        return _K[Output][StateIndex];
+
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+void LqrMimo<M, N>::SetReference(uint8_t StateIndex, float NewReference)
+{
+    if (StateIndex < N)
+        _Ref[StateIndex] = NewReference;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+float LqrMimo<M, N>::GetReference(uint8_t StateIndex)
+{
+    if (StateIndex < N)
+        return _Ref[StateIndex];
+
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+void LqrMimo<M, N>::SetState(uint8_t StateIndex, float NewState)
+{
+    if (StateIndex < N)
+        _State[StateIndex] = NewState;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+inline void LqrMimo<M, N>::SetStates(const float *States)
+{
+    if (States == nullptr)
+        return;
+
+    for (uint8_t Idx = 0; Idx < N; Idx++)
+        _State[Idx] = States[Idx];
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+float LqrMimo<M, N>::GetState(uint8_t StateIndex)
+{
+    if (StateIndex < N)
+        return _State[StateIndex];
+
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+float *LqrMimo<M, N>::GetStateBuffer()
+{
+    return _State;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+void LqrMimo<M, N>::SetLimits(uint8_t Output, const float Ut_min, const float Ut_max)
+{
+    if (Output < M)
+    {
+        _Ut_min[Output] = Ut_min;
+        _Ut_max[Output] = Ut_max;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+void LqrMimo<M, N>::GetLimits(uint8_t Output, float *Buffer)
+{
+    if (Output < M)
+    {
+        Buffer[0] = _Ut_min[Output];
+        Buffer[1] = _Ut_max[Output];
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+bool LqrMimo<M, N>::GetSaturated(uint8_t Output)
+{
+    return (Output < M) ? ((_Saturated >> Output) & 1) : false;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+uint32_t LqrMimo<M, N>::GetSaturatedMask()
+{
+    return _Saturated;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+float LqrMimo<M, N>::GetOutput(uint8_t Output)
+{
+    return (Output < M) ? _Ut_nxt[Output] : 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+void LqrMimo<M, N>::Compute(float *Ut)
+{
+    // State error - Once for all outputs
+    for (uint8_t Col = 0; Col < N; Col++)
+        _E[Col] = _Ref[Col] - _State[Col];
+
+    uint8_t Row = 0;
+
+    // Blocks of 4 rows - Each error value feeds 4 accumulators
+    for (; (uint16_t)(Row + LQR_MIMO_BLOCK) <= M; Row += LQR_MIMO_BLOCK)
+    {
+        const float *K0 = _K[Row];
+        const float *K1 = _K[Row + 1];
+        const float *K2 = _K[Row + 2];
+        const float *K3 = _K[Row + 3];
+
+        float Acc0 = 0, Acc1 = 0, Acc2 = 0, Acc3 = 0;
+
+        for (uint8_t Col = 0; Col < N; Col++)
+        {
+            float E = _E[Col];
+
+            Acc0 += K0[Col] * E;
+            Acc1 += K1[Col] * E;
+            Acc2 += K2[Col] * E;
+            Acc3 += K3[Col] * E;
+        }
+
+        _Ut_nxt[Row] = Acc0;
+        _Ut_nxt[Row + 1] = Acc1;
+        _Ut_nxt[Row + 2] = Acc2;
+        _Ut_nxt[Row + 3] = Acc3;
+    }
+
+    // Remaining rows
+    for (; Row < M; Row++)
+    {
+        float Acc = 0;
+
+        for (uint8_t Col = 0; Col < N; Col++)
+            Acc += _K[Row][Col] * _E[Col];
+
+        _Ut_nxt[Row] = Acc;
+    }
+
+    // Limiters
+    uint32_t Saturated = 0;
+
+    for (Row = 0; Row < M; Row++)
+    {
+        // Maximum output exceeded
+        if (_Ut_nxt[Row] >= _Ut_max[Row])
+        {
+            _Ut_nxt[Row] = _Ut_max[Row];
+            Saturated |= (1UL << Row);
+        }
+
+        // Minimum output exceeded
+        else if (_Ut_nxt[Row] <= _Ut_min[Row])
+        {
+            _Ut_nxt[Row] = _Ut_min[Row];
+            Saturated |= (1UL << Row);
+        }
+
+        if (Ut != nullptr)
+            Ut[Row] = _Ut_nxt[Row];
+    }
+
+    _Saturated = Saturated;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t M, uint8_t N>
+void LqrMimo<M, N>::Compute(const float *States, float *Ut)
+{
+    SetStates(States);
+    Compute(Ut);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
@@ -0,0 +1,499 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Fixed-size LQR controller library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      LqrN<N> implements the Lqr control law (Ut = K * (Ref - State)) with exactly N states:
+//          - K, Ref and State are N floats long (Lqr always reserves MAX_LQR_STATES)
+//          - There is no runtime state count; Compute is a dot product with a constant length
+//          - The error vector is only stored when TELEMETRY_ENABLE is set (it is not needed otherwise)
+
+//      Compute kernels, selected at compile time:
+//          N <= LQRN_UNROLL_MAX    Fully unrolled dot product, summed in state order (same result as Lqr)
+//          N >  LQRN_UNROLL_MAX    Loop; on hosts with SSE or NEON, 8 states per iteration with vector
+//                                  extensions (partial sums, so the rounding differs from Lqr)
+
+//      The Lqr class is kept unchanged for code that sets the number of states at run time.
+
+//      Usage example:
+//          const float K[4] = {...}, Ref[4] = {0};
+//          LqrN<4> Balance(K, Ref, -12.0f, 12.0f);
+//          float States[4] = {X, dX, Theta, dTheta};
+//          float U = Balance.Compute(States);
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef LQRN_TIVAC_H_
+#define LQRN_TIVAC_H_
+
+// Templates must have C++ linkage
+#ifdef __cplusplus
+extern "C++"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// Controller telemetry
+#include "Telemetry_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#define LQRN_UNROLL_MAX 16              // Largest N computed with the unrolled kernel
+
+// Host vector kernel - GCC / Clang vector extensions (no intrinsics header needed)
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__SSE__) || defined(__ARM_NEON))
+#define LQRN_VECTOR
+typedef float lqrn_f4_t __attribute__((vector_size(16)));
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototypes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Unrolled dot product K * (Ref - State) of the first I states, summed in state order
+template <uint8_t I>
+struct LqrNUnroll
+{
+    static inline float Sum(const float *K, const float *Ref, const float *State)
+    {
+        return LqrNUnroll<I - 1>::Sum(K, Ref, State) + K[I - 1] * (Ref[I - 1] - State[I - 1]);
+    }
+};
+
+template <>
+struct LqrNUnroll<0>
+{
+    static inline float Sum(const float *K, const float *Ref, const float *State)
+    {
+        (void)K; (void)Ref; (void)State;
+        return 0;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+class LqrN
+{
+    static_assert(N >= 1, "LqrN needs at least one state");
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        float _K[N] = {0};              // Gain matrix
+        float _Ref[N] = {0};            // Setpoint
+        float _State[N] = {0};          // State values (sample k)
+#if TELEMETRY_ENABLE
+        float _E[N] = {0};              // Error (sample k) - Telemetry only
+#endif
+        float _Ut_nxt = 0;              // Control action (sample k + 1)
+        float _Ut_min = 0;              // Minimum output value
+        float _Ut_max = 0;              // Maximum output value
+        bool _Saturated = false;        // Saturation flag
+        uint8_t _TelemetryId = 0;       // Telemetry id
+        uint8_t _TelemetryChannel = 0;  // Telemetry ring
+
+        // Name:        _Sum
+        // Description: Computes K * (Ref - State) with the kernel selected for N
+        // Arguments:   None
+        // Returns:     The unlimited control action
+        float _Sum();
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        LqrN
+        // Description: Constructor of the class with no arguments
+        // Arguments:   None
+        // Returns:     None
+        LqrN();
+
+        // Name:        LqrN
+        // Description: Constructor of the class with gains, references and limit arguments
+        // Arguments:   Gains - The gain vector (N values)
+        //              Refs - The reference vector (N values)
+        //              Ut_min - Minimum output value
+        //              Ut_max - Maximum output value
+        // Returns:     None
+        LqrN(const float *Gains, const float *Refs, const float Ut_min, const float Ut_max);
+
+        // Name:        Init
+        // Description: Initialises the LQR with gains, references and limit arguments
+        // Arguments:   Gains - The gain vector (N values)
+        //              Refs - The reference vector (N values)
+        //              Ut_min - Minimum output value
+        //              Ut_max - Maximum output value
+        // Returns:     None
+        void Init(const float *Gains, const float *Refs, const float Ut_min, const float Ut_max);
+
+        // Name:        SetGain
+        // Description: Sets the gain associated to one state
+        // Arguments:   StateIndex - Index of the state associated with the new value
+        //              NewGain - The gain value
+        // Returns:     None
+        void SetGain(uint8_t StateIndex, float NewGain);
+
+        // Name:        SetGains
+        // Description: Sets the gains of all states
+        // Arguments:   Gains - The gain vector (N values)
+        // Returns:     None
+        void SetGains(const float *Gains);
+
+        // Name:        SetReference
+        // Description: Sets the reference associated to one state
+        // Arguments:   StateIndex - Index of the state associated with the new value
+        //              NewReference - The reference value
+        // Returns:     None
+        void SetReference(uint8_t StateIndex, float NewReference);
+
+        // Name:        SetReferences
+        // Description: Sets the references of all states
+        // Arguments:   Refs - The reference vector (N values)
+        // Returns:     None
+        void SetReferences(const float *Refs);
+
+        // Name:        GetReference
+        // Description: Gets the reference associated to one state
+        // Arguments:   StateIndex - Index of the state associated with the new value
+        // Returns:     The reference value
+        float GetReference(uint8_t StateIndex);
+
+        // Name:        SetState
+        // Description: Sets the value of one state
+        // Arguments:   StateIndex - Index of the state
+        //              NewState - The state value
+        // Returns:     None
+        void SetState(uint8_t StateIndex, float NewState);
+
+        // Name:        SetStates
+        // Description: Sets the values of all states
+        // Arguments:   States - The state vector (N values)
+        // Returns:     None
+        void SetStates(const float *States);
+
+        // Name:        GetState
+        // Description: Gets the value of one state
+        // Arguments:   StateIndex - Index of the state
+        // Returns:     The state value
+        float GetState(uint8_t StateIndex);
+
+        // Name:        GetStateBuffer
+        // Description: Gets the state array, so an observer can write its estimate in place
+        // Arguments:   None
+        // Returns:     Pointer to the state values (N values)
+        float *GetStateBuffer();
+
+        // Name:        SetLimits
+        // Description: Sets the controller output limits
+        // Arguments:   Ut_min - Minimum output value
+        //              Ut_max - Maximum output value
+        // Returns:     None
+        void SetLimits(const float Ut_min, const float Ut_max);
+
+        // Name:        GetLimits
+        // Description: Gets the controller output limits
+        // Arguments:   Buffer - Buffer to receive the values
+        // Returns:     None
+        void GetLimits(float *Buffer);
+
+        // Name:        GetSaturated
+        // Description: Gets the saturation flag of the last sample
+        // Arguments:   None
+        // Returns:     True if the output was limited in the last sample
+        bool GetSaturated();
+
+        // Name:        SetTelemetryId
+        // Description: Sets the id written in the telemetry records of this controller and its ring
+        // Arguments:   Id - Controller id
+        //              Channel - Telemetry ring (0 to TELEMETRY_CHANNELS - 1, one per ISR priority)
+        // Returns:     None
+        void SetTelemetryId(uint8_t Id, uint8_t Channel = 0);
+
+        // Name:        Compute
+        // Description: Computes the control action
+        // Arguments:   None
+        // Returns:     The new control action
+        float Compute();
+
+        // Name:        Compute
+        // Description: Sets the values of all states and computes the control action
+        // Arguments:   States - The state vector (N values)
+        // Returns:     The new control action
+        float Compute(const float *States);
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+LqrN<N>::LqrN()
+{
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+LqrN<N>::LqrN(const float *Gains, const float *Refs, const float Ut_min, const float Ut_max)
+{
+    Init(Gains, Refs, Ut_min, Ut_max);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void LqrN<N>::Init(const float *Gains, const float *Refs, const float Ut_min, const float Ut_max)
+{
+    SetGains(Gains);
+    SetReferences(Refs);
+    SetLimits(Ut_min, Ut_max);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void LqrN<N>::SetGain(uint8_t StateIndex, float NewGain)
+{
+    if (StateIndex < N)
+        _K[StateIndex] = NewGain;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void LqrN<N>::SetGains(const float *Gains)
+{
+    if (Gains == nullptr)
+        return;
+
+    for (uint8_t Idx = 0; Idx < N; Idx++)
+        _K[Idx] = Gains[Idx];
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void LqrN<N>::SetReference(uint8_t StateIndex, float NewReference)
+{
+    if (StateIndex < N)
+        _Ref[StateIndex] = NewReference;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void LqrN<N>::SetReferences(const float *Refs)
+{
+    if (Refs == nullptr)
+        return;
+
+    for (uint8_t Idx = 0; Idx < N; Idx++)
+        _Ref[Idx] = Refs[Idx];
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+float LqrN<N>::GetReference(uint8_t StateIndex)
+{
+    if (StateIndex < N)
+        return _Ref[StateIndex];
+
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void LqrN<N>::SetState(uint8_t StateIndex, float NewState)
+{
+    if (StateIndex < N)
+        _State[StateIndex] = NewState;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+inline void LqrN<N>::SetStates(const float *States)
+{
+    if (States == nullptr)
+        return;
+
+    for (uint8_t Idx = 0; Idx < N; Idx++)
+        _State[Idx] = States[Idx];
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+float LqrN<N>::GetState(uint8_t StateIndex)
+{
+    if (StateIndex < N)
+        return _State[StateIndex];
+
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+float *LqrN<N>::GetStateBuffer()
+{
+    return _State;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void LqrN<N>::SetLimits(const float Ut_min, const float Ut_max)
+{
+    _Ut_min = Ut_min;
+    _Ut_max = Ut_max;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void LqrN<N>::GetLimits(float *Buffer)
+{
+    Buffer[0] = _Ut_min;
+    Buffer[1] = _Ut_max;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+bool LqrN<N>::GetSaturated()
+{
+    return _Saturated;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+void LqrN<N>::SetTelemetryId(uint8_t Id, uint8_t Channel)
+{
+    _TelemetryId = Id;
+    _TelemetryChannel = (Channel < TELEMETRY_CHANNELS) ? Channel : (TELEMETRY_CHANNELS - 1);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+inline float LqrN<N>::_Sum()
+{
+    // Small N - Unrolled (the other branch is removed by the compiler)
+    if (N <= LQRN_UNROLL_MAX)
+        return LqrNUnroll<(N <= LQRN_UNROLL_MAX) ? N : 0>::Sum(_K, _Ref, _State);
+
+    uint8_t Idx = 0;
+    float Sum = 0;
+
+#if defined(LQRN_VECTOR)
+    // Large N on the host - 8 states per iteration in two 4-wide partial sums
+    lqrn_f4_t Acc0 = {0, 0, 0, 0};
+    lqrn_f4_t Acc1 = {0, 0, 0, 0};
+
+    for (; (uint16_t)(Idx + 8) <= N; Idx += 8)
+    {
+        lqrn_f4_t K0, K1, R0, R1, S0, S1;
+
+        __builtin_memcpy(&K0, &_K[Idx], sizeof(K0));
+        __builtin_memcpy(&K1, &_K[Idx + 4], sizeof(K1));
+        __builtin_memcpy(&R0, &_Ref[Idx], sizeof(R0));
+        __builtin_memcpy(&R1, &_Ref[Idx + 4], sizeof(R1));
+        __builtin_memcpy(&S0, &_State[Idx], sizeof(S0));
+        __builtin_memcpy(&S1, &_State[Idx + 4], sizeof(S1));
+
+        Acc0 += K0 * (R0 - S0);
+        Acc1 += K1 * (R1 - S1);
+    }
+
+    Acc0 += Acc1;
+    Sum = (Acc0[0] + Acc0[1]) + (Acc0[2] + Acc0[3]);
+#endif
+
+    // Remaining states
+    for (; Idx < N; Idx++)
+        Sum += _K[Idx] * (_Ref[Idx] - _State[Idx]);
+
+    return Sum;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+float LqrN<N>::Compute()
+{
+#if TELEMETRY_ENABLE
+    // Error vector - Telemetry only
+    for (uint8_t Idx = 0; Idx < N; Idx++)
+        _E[Idx] = _Ref[Idx] - _State[Idx];
+#endif
+
+    // Calculate control action
+    _Ut_nxt = _Sum();
+
+    // Limiter - Maximum output exceeded
+    if (_Ut_nxt >= _Ut_max)
+    {
+        _Ut_nxt = _Ut_max;
+        _Saturated = true;
+    }
+
+    // Limiter - Minimum output exceeded
+    else if (_Ut_nxt <= _Ut_min)
+    {
+        _Ut_nxt = _Ut_min;
+        _Saturated = true;
+    }
+
+    // Limiter - Between limits
+    else
+        _Saturated = false;
+
+    // Telemetry tap
+    TELEMETRY_PUSH(TELEMETRY_LQR, _TelemetryChannel, _TelemetryId, _Saturated, _E[0], 0, 0, 0, _Ut_nxt);
+
+    // Return calculated value
+    return _Ut_nxt;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N>
+float LqrN<N>::Compute(const float *States)
+{
+    SetStates(States);
+
+    return Compute();
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
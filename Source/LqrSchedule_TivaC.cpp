@@ -0,0 +1,213 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// LQR gain schedule library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// LQR gain schedule defines and macros
+#include "LqrSchedule_TivaC.hpp"
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        LqrSchedule
+// Description: Constructor of the class with no arguments
+// Arguments:   None
+// Returns:     None
+
+LqrSchedule::LqrSchedule()
+{
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Init
+// Description: Sets the gain and reference tables and the scheduling range
+// Arguments:   Gains - Gains at each breakpoint (Count x Size, row-major)
+//              Refs - References at each breakpoint (Count x Size, row-major, nullptr = fixed)
+//              Count - Number of breakpoints (2 to MAX_LQR_SCHEDULE_POINTS)
+//              Size - Values per breakpoint (Lqr::GetGainCount, states + 1 in LQI mode)
+//              X_min - Scheduling variable at the first breakpoint
+//              X_max - Scheduling variable at the last breakpoint (must be greater than X_min)
+// Returns:     True if the tables were accepted, false otherwise
+
+bool LqrSchedule::Init(const float *Gains, const float *Refs, uint8_t Count, uint8_t Size, float X_min,
+                       float X_max)
+{
+    // Invalid table
+    if ((Gains == nullptr) || (Count < 2) || (Count > MAX_LQR_SCHEDULE_POINTS) ||
+        (Size == 0) || (Size > MAX_LQR_STATES) || (X_max <= X_min))
+        return false;
+
+    _Data.Count = Count;
+    _Data.Size = Size;
+    _Data.Scheduled = (Refs != nullptr);
+
+    for (uint8_t Idx = 0; Idx < Count; Idx++)
+        SetPoint(Idx, &Gains[Idx * Size], (Refs != nullptr) ? &Refs[Idx * Size] : nullptr);
+
+    _Data.X_min = X_min;
+    _Data.X_max = X_max;
+
+    // Inverse of the breakpoint spacing - The only division
+    _Data.InvDx = (float)(Count - 1) / (X_max - X_min);
+
+    // First Update always interpolates
+    _Data.Pending = true;
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetPoint
+// Description: Sets the gains and references at one breakpoint
+// Arguments:   Idx - Index of the breakpoint
+//              Gains - The gains (Size values)
+//              Refs - The references (Size values, nullptr = unchanged)
+// Returns:     None
+
+void LqrSchedule::SetPoint(uint8_t Idx, const float *Gains, const float *Refs)
+{
+    if (Idx >= _Data.Count)
+        return;
+
+    for (uint8_t Col = 0; Col < _Data.Size; Col++)
+    {
+        if (Gains != nullptr)
+            _Data.K[Idx][Col] = Gains[Col];
+
+        if (Refs != nullptr)
+            _Data.Ref[Idx][Col] = Refs[Col];
+    }
+
+    // Table changed - Next Update interpolates
+    _Data.Pending = true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetThreshold
+// Description: Sets the change of the scheduling variable that triggers a new interpolation
+// Arguments:   Threshold - Minimum change of X (0 = interpolate on every Update)
+// Returns:     None
+
+void LqrSchedule::SetThreshold(float Threshold)
+{
+    _Data.Threshold = (Threshold > 0) ? Threshold : 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Lookup
+// Description: Interpolates the gains and references for a value of the scheduling variable
+// Arguments:   X - Scheduling variable
+//              Gains - Buffer to receive the gains (Size values)
+//              Refs - Buffer to receive the references (Size values, nullptr = not needed)
+// Returns:     None
+
+void LqrSchedule::Lookup(float X, float *Gains, float *Refs)
+{
+    // Position in the table (breakpoint units)
+    float Pos = (X - _Data.X_min) * _Data.InvDx;
+
+    // Segment and fraction - Ends of the table use the first or last breakpoint (NaN = first)
+    uint8_t Idx;
+    float Frac;
+
+    if (!(Pos > 0))
+    {
+        Idx = 0;
+        Frac = 0;
+    }
+
+    else if (Pos >= (float)(_Data.Count - 1))
+    {
+        Idx = _Data.Count - 2;
+        Frac = 1;
+    }
+
+    else
+    {
+        Idx = (uint8_t)Pos;
+        Frac = Pos - (float)Idx;
+    }
+
+    // Linear interpolation
+    for (uint8_t Col = 0; Col < _Data.Size; Col++)
+    {
+        float Lo = _Data.K[Idx][Col];
+        Gains[Col] = Lo + Frac * (_Data.K[Idx + 1][Col] - Lo);
+    }
+
+    if (Refs == nullptr)
+        return;
+
+    for (uint8_t Col = 0; Col < _Data.Size; Col++)
+    {
+        float Lo = _Data.Ref[Idx][Col];
+        Refs[Col] = Lo + Frac * (_Data.Ref[Idx + 1][Col] - Lo);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Update
+// Description: Interpolates and applies the gains and references if X moved past the threshold
+// Arguments:   Controller - Controller to be updated
+//              X - Scheduling variable
+// Returns:     True if the controller was updated, false if skipped or if its gain count is not Size
+
+bool LqrSchedule::Update(Lqr *Controller, float X)
+{
+    // Empty table
+    if ((Controller == nullptr) || (_Data.Count == 0))
+        return false;
+
+    // Table built for another controller shape - SetGains would read past the interpolated gains
+    if (Controller->GetGainCount() != _Data.Size)
+        return false;
+
+    // Movement outside the table does not change the result (NaN = first breakpoint)
+    if (!(X >= _Data.X_min))
+        X = _Data.X_min;
+
+    else if (X > _Data.X_max)
+        X = _Data.X_max;
+
+    // Amortization - Skip while X stays within the threshold of the last interpolation
+    float Dx = X - _Data.X_lst;
+    Dx = (Dx < 0) ? -Dx : Dx;
+
+    if (!_Data.Pending && (Dx < _Data.Threshold))
+        return false;
+
+    float Gains[MAX_LQR_STATES];
+    float Refs[MAX_LQR_STATES];
+
+    Lookup(X, Gains, _Data.Scheduled ? Refs : nullptr);
+
+    Controller->SetGains(Gains);
+
+    if (_Data.Scheduled)
+        Controller->SetReferences(Refs);
+
+    _Data.X_lst = X;
+    _Data.Pending = false;
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
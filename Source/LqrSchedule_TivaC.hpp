@@ -0,0 +1,172 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// LQR gain schedule library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      This library holds LQR gain vectors (and optionally reference vectors, e.g. the equilibrium of
+//      each operating point) at uniformly spaced breakpoints of a scheduling variable X and linearly
+//      interpolates between them, so one Lqr object covers the whole operating range without the
+//      jumps of switching between controllers.
+
+//      The breakpoint spacing is inverted once in Init, so a lookup is constant time with no division.
+//      Update only interpolates when X has moved more than Threshold since the last interpolation:
+//      while the operating point is steady it costs one comparison, and the gains still change in
+//      steps no larger than Threshold times the table slope.
+
+//      Update writes to the controller, so it must run in the same context as Lqr::Compute (usually
+//      right before it in the control ISR).
+
+//      Values of X outside [X_min, X_max] use the first or last breakpoint.
+
+//      Usage example (3 states, 5 breakpoints over 0 to 100 rad/s):
+//          LqrSchedule Schedule;
+//          Schedule.Init(&K[0][0], &Ref[0][0], 5, 3, 0.0f, 100.0f);
+//          Schedule.SetThreshold(0.5f);
+//          ...
+//          Schedule.Update(&Controller, Speed);
+//          U = Controller.Compute();
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef LQRSCHEDULE_TIVAC_H_
+#define LQRSCHEDULE_TIVAC_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// LQR controller
+#include "Lqr_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#define MAX_LQR_SCHEDULE_POINTS 16      // Maximum number of breakpoints
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// LQR gain schedule variables
+typedef struct
+{
+    float K[MAX_LQR_SCHEDULE_POINTS][MAX_LQR_STATES];     // Gains at each breakpoint
+    float Ref[MAX_LQR_SCHEDULE_POINTS][MAX_LQR_STATES];   // References at each breakpoint
+    uint8_t Count;                      // Number of breakpoints
+    uint8_t Size;                       // Values per breakpoint
+    float X_min;                        // Scheduling variable at the first breakpoint
+    float X_max;                        // Scheduling variable at the last breakpoint
+    float InvDx;                        // Inverse of the breakpoint spacing
+    float Threshold;                    // Change of X that triggers a new interpolation
+    float X_lst;                        // Scheduling variable of the last interpolation
+    bool Scheduled;                     // References scheduled flag
+    bool Pending;                       // Interpolation required on the next Update
+} lqr_schedule_t;
+
+// LQR gain schedule variables - Default values
+#define lqr_schedule_t_default { \
+    .K = {{0}}, \
+    .Ref = {{0}}, \
+    .Count = 0, \
+    .Size = 0, \
+    .X_min = 0, \
+    .X_max = 0, \
+    .InvDx = 0, \
+    .Threshold = 0, \
+    .X_lst = 0, \
+    .Scheduled = false, \
+    .Pending = true, \
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+class LqrSchedule
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        // Schedule data
+        lqr_schedule_t _Data = lqr_schedule_t_default;
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        LqrSchedule
+        // Description: Constructor of the class with no arguments
+        // Arguments:   None
+        // Returns:     None
+        LqrSchedule();
+
+        // Name:        Init
+        // Description: Sets the gain and reference tables and the scheduling range
+        // Arguments:   Gains - Gains at each breakpoint (Count x Size, row-major)
+        //              Refs - References at each breakpoint (Count x Size, row-major, nullptr = fixed)
+        //              Count - Number of breakpoints (2 to MAX_LQR_SCHEDULE_POINTS)
+        //              Size - Values per breakpoint (Lqr::GetGainCount, states + 1 in LQI mode)
+        //              X_min - Scheduling variable at the first breakpoint
+        //              X_max - Scheduling variable at the last breakpoint (must be greater than X_min)
+        // Returns:     True if the tables were accepted, false otherwise
+        bool Init(const float *Gains, const float *Refs, uint8_t Count, uint8_t Size, float X_min,
+                  float X_max);
+
+        // Name:        SetPoint
+        // Description: Sets the gains and references at one breakpoint
+        // Arguments:   Idx - Index of the breakpoint
+        //              Gains - The gains (Size values)
+        //              Refs - The references (Size values, nullptr = unchanged)
+        // Returns:     None
+        void SetPoint(uint8_t Idx, const float *Gains, const float *Refs);
+
+        // Name:        SetThreshold
+        // Description: Sets the change of the scheduling variable that triggers a new interpolation
+        // Arguments:   Threshold - Minimum change of X (0 = interpolate on every Update)
+        // Returns:     None
+        void SetThreshold(float Threshold);
+
+        // Name:        Lookup
+        // Description: Interpolates the gains and references for a value of the scheduling variable
+        // Arguments:   X - Scheduling variable
+        //              Gains - Buffer to receive the gains (Size values)
+        //              Refs - Buffer to receive the references (Size values, nullptr = not needed)
+        // Returns:     None
+        void Lookup(float X, float *Gains, float *Refs);
+
+        // Name:        Update
+        // Description: Interpolates and applies the gains and references if X moved past the threshold
+        // Arguments:   Controller - Controller to be updated
+        //              X - Scheduling variable
+        // Returns:     True if the controller was updated, false if skipped or if its gain count is not Size
+        bool Update(Lqr *Controller, float X);
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
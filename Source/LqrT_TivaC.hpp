@@ -0,0 +1,257 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Templated LQR controller library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      LqrT<T, N> implements the Lqr control law (Ut = K * (Ref - State)) with N states for any number
+//      type supported by Num<T> (float, q15_t or q31_t, see Fixed_TivaC.hpp).
+
+//      Gains share one power of two scale (see SetScale). Gains set with SetGainFloat are converted
+//      once, outside the sample path. The products are summed in the wide accumulator and saturated
+//      once, after the last state.
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef LQRT_TIVAC_H_
+#define LQRT_TIVAC_H_
+
+// Templates must have C++ linkage
+#ifdef __cplusplus
+extern "C++"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// Number traits
+#include "Fixed_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint8_t N>
+class LqrT
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        typedef typename Num<T>::Acc Acc;
+
+        T _K[N] = {0};              // Gain matrix
+        T _Ref[N] = {0};            // Setpoint
+        T _State[N] = {0};          // State values (sample k)
+        T _Ut_nxt = 0;              // Control action (sample k + 1)
+        uint8_t _Scale = 0;         // Gain scale (power of two)
+        T _Ut_min = 0;              // Minimum output value
+        T _Ut_max = 0;              // Maximum output value
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        SetScale
+        // Description: Sets the power of two scale shared by all gains
+        // Arguments:   Scale - Gain scale (gain real value = gain * 2^Scale, limited to Num<T>::ScaleMax)
+        // Returns:     None
+        void SetScale(uint8_t Scale);
+
+        // Name:        SetGain
+        // Description: Sets the gain associated to one state (already scaled)
+        // Arguments:   StateIndex - Index of the state associated with the new value
+        //              NewGain - The gain value
+        // Returns:     None
+        void SetGain(uint8_t StateIndex, T NewGain);
+
+        // Name:        SetGainFloat
+        // Description: Sets the gain associated to one state from a real value using the current scale
+        // Arguments:   StateIndex - Index of the state associated with the new value
+        //              NewGain - The gain value
+        // Returns:     None
+        void SetGainFloat(uint8_t StateIndex, float NewGain);
+
+        // Name:        SetReference
+        // Description: Sets the reference associated to one state
+        // Arguments:   StateIndex - Index of the state associated with the new value
+        //              NewReference - The reference value
+        // Returns:     None
+        void SetReference(uint8_t StateIndex, T NewReference);
+
+        // Name:        GetReference
+        // Description: Gets the reference associated to one state
+        // Arguments:   StateIndex - Index of the state associated with the new value
+        // Returns:     The reference value
+        T GetReference(uint8_t StateIndex);
+
+        // Name:        SetState
+        // Description: Sets the value of one state
+        // Arguments:   StateIndex - Index of the state
+        //              NewState - The state value
+        // Returns:     None
+        void SetState(uint8_t StateIndex, T NewState);
+
+        // Name:        GetState
+        // Description: Gets the value of one state
+        // Arguments:   StateIndex - Index of the state
+        // Returns:     The state value
+        T GetState(uint8_t StateIndex);
+
+        // Name:        SetLimits
+        // Description: Sets the controller output limits
+        // Arguments:   Ut_min - Minimum output value
+        //              Ut_max - Maximum output value
+        // Returns:     None
+        void SetLimits(const T Ut_min, const T Ut_max);
+
+        // Name:        GetLimits
+        // Description: Gets the controller output limits
+        // Arguments:   Buffer - Buffer to receive the values
+        // Returns:     None
+        void GetLimits(T *Buffer);
+
+        // Name:        Compute
+        // Description: Computes the control action
+        // Arguments:   None
+        // Returns:     The new control action
+        T Compute();
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint8_t N>
+void LqrT<T, N>::SetScale(uint8_t Scale)
+{
+    if (Scale > Num<T>::ScaleMax)
+        Scale = Num<T>::ScaleMax;
+
+    _Scale = Scale;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint8_t N>
+void LqrT<T, N>::SetGain(uint8_t StateIndex, T NewGain)
+{
+    if (StateIndex < N)
+        _K[StateIndex] = NewGain;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint8_t N>
+void LqrT<T, N>::SetGainFloat(uint8_t StateIndex, float NewGain)
+{
+    SetGain(StateIndex, Num<T>::FromFloat(NewGain, _Scale));
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint8_t N>
+void LqrT<T, N>::SetReference(uint8_t StateIndex, T NewReference)
+{
+    if (StateIndex < N)
+        _Ref[StateIndex] = NewReference;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint8_t N>
+T LqrT<T, N>::GetReference(uint8_t StateIndex)
+{
+    if (StateIndex < N)
+        return _Ref[StateIndex];
+
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint8_t N>
+void LqrT<T, N>::SetState(uint8_t StateIndex, T NewState)
+{
+    if (StateIndex < N)
+        _State[StateIndex] = NewState;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint8_t N>
+T LqrT<T, N>::GetState(uint8_t StateIndex)
+{
+    if (StateIndex < N)
+        return _State[StateIndex];
+
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint8_t N>
+void LqrT<T, N>::SetLimits(const T Ut_min, const T Ut_max)
+{
+    _Ut_min = Ut_min;
+    _Ut_max = Ut_max;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint8_t N>
+void LqrT<T, N>::GetLimits(T *Buffer)
+{
+    Buffer[0] = _Ut_min;
+    Buffer[1] = _Ut_max;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint8_t N>
+T LqrT<T, N>::Compute()
+{
+    // Calculate state error and control action
+    Acc Ut_nxt = 0;
+
+    for (uint8_t Idx = 0; Idx < N; Idx++)
+        Ut_nxt = Num<T>::Add(Ut_nxt, Num<T>::Mul(_K[Idx], Num<T>::Sub(_Ref[Idx], _State[Idx]), _Scale));
+
+    // Limiter - Maximum output exceeded
+    if (Ut_nxt >= (Acc)_Ut_max)
+        _Ut_nxt = _Ut_max;
+
+    // Limiter - Minimum output exceeded
+    else if (Ut_nxt <= (Acc)_Ut_min)
+        _Ut_nxt = _Ut_min;
+
+    // Limiter - Between limits
+    else
+        _Ut_nxt = Num<T>::Sat(Ut_nxt);
+
+    // Return calculated value
+    return _Ut_nxt;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
@@ -17,6 +17,10 @@
 
 // Standard libraries
 #include <stdint.h>
+#include <string.h>
+
+// Execution time measurement
+#include "Wcet_TivaC.hpp"
 
 // ------------------------------------------------------------------------------------------------------- //
 // Functions definitions
@@ -64,12 +68,11 @@ void Lqr::Init(const float* Gains, const float* Refs, uint8_t Size, const float
     if (Size <= MAX_LQR_STATES)
     {
         _StateCount = Size;
+        _GainCount = Size;
+        _Data.Integral = LQR_NO_INTEGRAL;
 
-        for (uint8_t Idx = 0; Idx < _StateCount; Idx++)
-        {
-            SetGain(Idx, Gains[Idx]);
-            SetReference(Idx, Refs[Idx]);
-        }
+        SetGains(Gains);
+        SetReferences(Refs);
     }
 
     SetLimits(Ut_min, Ut_max);
@@ -85,12 +88,37 @@ void Lqr::Init(const float* Gains, const float* Refs, uint8_t Size, const float
 
 void Lqr::SetGain(uint8_t StateIndex, float NewGain)
 {
-    if (StateIndex < _StateCount)
+    if (StateIndex < _GainCount)
         _Data.K[StateIndex] = NewGain;
 }
 
 // ------------------------------------------------------------------------------------------------------- //
 
+// Name:        SetGains
+// Description: Sets the gains of all states (and of the integrator in LQI mode)
+// Arguments:   Gains - The gain vector (one value per state, then the integrator gain)
+// Returns:     None
+
+void Lqr::SetGains(const float *Gains)
+{
+    if (Gains != nullptr)
+        memcpy(_Data.K, Gains, _GainCount * sizeof(float));
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetGainCount
+// Description: Gets the number of gains (states, plus the integrator in LQI mode)
+// Arguments:   None
+// Returns:     Number of values SetGains reads
+
+uint8_t Lqr::GetGainCount()
+{
+    return _GainCount;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
 // Name:        SetReference
 // Description: Sets the reference associated to one state
 // Arguments:   StateIndex - Index of the state associated with the new value
@@ -105,6 +133,19 @@ void Lqr::SetReference(uint8_t StateIndex, float NewReference)
 
 // ------------------------------------------------------------------------------------------------------- //
 
+// Name:        SetReferences
+// Description: Sets the references of all states
+// Arguments:   Refs - The reference vector (one value per state)
+// Returns:     None
+
+void Lqr::SetReferences(const float *Refs)
+{
+    if (Refs != nullptr)
+        memcpy(_Data.Ref, Refs, _StateCount * sizeof(float));
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
 // Name:        GetReference
 // Description: Gets the reference associated to one state
 // Arguments:   StateIndex - Index of the state associated with the new value
@@ -135,6 +176,19 @@ void Lqr::SetState(uint8_t StateIndex, float NewState)
 
 // ------------------------------------------------------------------------------------------------------- //
 
+// Name:        SetStates
+// Description: Sets the values of all states
+// Arguments:   States - The state vector (one value per state)
+// Returns:     None
+
+void Lqr::SetStates(const float *States)
+{
+    if (States != nullptr)
+        memcpy(_Data.State, States, _StateCount * sizeof(float));
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
 // Name:        GetState
 // Description: Gets the value of one state
 // Arguments:   StateIndex - Index of the state
@@ -150,6 +204,82 @@ float Lqr::GetState(uint8_t StateIndex)
 
 // ------------------------------------------------------------------------------------------------------- //
 
+// Name:        GetStateBuffer
+// Description: Gets the state array, so an observer can write its estimate in place
+// Arguments:   None
+// Returns:     Pointer to the state values (MAX_LQR_STATES values)
+
+float *Lqr::GetStateBuffer()
+{
+    return _Data.State;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetIntegral
+// Description: Enables the LQI mode - Integral action on the error of one state
+// Arguments:   StateIndex - Index of the integrated state (LQR_NO_INTEGRAL = disable)
+// Returns:     True if the mode was set, false if there is no room for the integrator
+
+bool Lqr::SetIntegral(uint8_t StateIndex)
+{
+    // The integrator z[k + 1] = z[k] + (State - Ref) is kept after the last state with a zero reference,
+    // so it is one more term of the gain vector. Its gain is the last element of the augmented design:
+    //      [x; z][k + 1] = [A 0; C 1] [x; z][k] + [B; 0] u[k]
+
+    // Disable
+    if (StateIndex == LQR_NO_INTEGRAL)
+    {
+        _Data.Integral = LQR_NO_INTEGRAL;
+        _GainCount = _StateCount;
+
+        return true;
+    }
+
+    if ((StateIndex >= _StateCount) || (_StateCount >= MAX_LQR_STATES))
+        return false;
+
+    _Data.Integral = StateIndex;
+    _GainCount = _StateCount + 1;
+
+    // Integrator starts empty
+    _Data.Ref[_StateCount] = 0;
+    _Data.State[_StateCount] = 0;
+    _Data.E[_StateCount] = 0;
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetIntegrator
+// Description: Sets the integrator value (LQI mode)
+// Arguments:   NewValue - The integrator value
+// Returns:     None
+
+void Lqr::SetIntegrator(float NewValue)
+{
+    if (_Data.Integral != LQR_NO_INTEGRAL)
+        _Data.State[_StateCount] = NewValue;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetIntegrator
+// Description: Gets the integrator value (LQI mode)
+// Arguments:   None
+// Returns:     The integrator value
+
+float Lqr::GetIntegrator()
+{
+    if (_Data.Integral != LQR_NO_INTEGRAL)
+        return _Data.State[_StateCount];
+
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
 // Name:        SetLimits
 // Description: Sets the controller output limits
 // Arguments:   Ut_min - Minimum output value
@@ -177,6 +307,44 @@ void Lqr::GetLimits(float *Buffer)
 
 // ------------------------------------------------------------------------------------------------------- //
 
+// Name:        SetHold
+// Description: Freezes or releases the integrator (LQI mode, e.g. while an inner loop is saturated)
+// Arguments:   Hold - True to freeze the integrator
+// Returns:     None
+
+void Lqr::SetHold(bool Hold)
+{
+    _Data.Hold = Hold;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetSaturated
+// Description: Gets the saturation flag of the last sample
+// Arguments:   None
+// Returns:     True if the output was limited in the last sample
+
+bool Lqr::GetSaturated()
+{
+    return _Data.Saturated;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetTelemetryId
+// Description: Sets the id written in the telemetry records of this controller and its ring
+// Arguments:   Id - Controller id
+//              Channel - Telemetry ring (0 to TELEMETRY_CHANNELS - 1, one per ISR priority)
+// Returns:     None
+
+void Lqr::SetTelemetryId(uint8_t Id, uint8_t Channel)
+{
+    _TelemetryId = Id;
+    _TelemetryChannel = (Channel < TELEMETRY_CHANNELS) ? Channel : (TELEMETRY_CHANNELS - 1);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
 // Name:        Compute
 // Description: Computes the control action
 // Arguments:   None
@@ -184,11 +352,14 @@ void Lqr::GetLimits(float *Buffer)
 
 float Lqr::Compute()
 {
+    // Execution time measurement
+    WCET_SCOPE(WCET_LQR);
+
     // Reset control action value value
     _Data.Ut_nxt = 0;
 
-    // Calculate state error and control action
-    for (uint8_t Idx = 0; Idx < _StateCount; Idx++)
+    // Calculate state error and control action - Integrator included in LQI mode
+    for (uint8_t Idx = 0; Idx < _GainCount; Idx++)
     {
         _Data.E[Idx] = _Data.Ref[Idx] - _Data.State[Idx];
         _Data.Ut_nxt += _Data.K[Idx] * _Data.E[Idx];
@@ -198,16 +369,88 @@ float Lqr::Compute()
     if (_Data.Ut_nxt >= _Data.Ut_max)
     {
         _Data.Ut_nxt = _Data.Ut_max;
+        _Data.Saturated = true;
     }
 
     // Limiter - Minimum output exceeded
     else if (_Data.Ut_nxt <= _Data.Ut_min)
     {
         _Data.Ut_nxt = _Data.Ut_min;
+        _Data.Saturated = true;
+    }
+
+    // Limiter - Between limits
+    else
+        _Data.Saturated = false;
+
+    // LQI mode - Integrator update (none while held)
+    if ((_Data.Integral != LQR_NO_INTEGRAL) && (_Data.Hold == false))
+    {
+        float Dz = -_Data.E[_Data.Integral];
+
+        // Anti-windup - While saturated, only integrate towards the inside of the limits
+        bool Update = !_Data.Saturated;
+
+        if (!Update)
+        {
+            float Du = -_Data.K[_StateCount] * Dz;
+            Update = (_Data.Ut_nxt == _Data.Ut_max) ? (Du < 0) : (Du > 0);
+        }
+
+        if (Update)
+            _Data.State[_StateCount] += Dz;
     }
 
+    // Telemetry tap
+    TELEMETRY_PUSH(TELEMETRY_LQR, _TelemetryChannel, _TelemetryId, _Data.Saturated, _Data.E[0],
+                   0, 0, 0, _Data.Ut_nxt);
+
     // Return calculated value
     return _Data.Ut_nxt;
 }
 
 // ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Compute
+// Description: Sets the values of all states and computes the control action
+// Arguments:   States - The state vector (one value per state)
+// Returns:     The new control action
+
+float Lqr::Compute(const float *States)
+{
+    SetStates(States);
+
+    return Compute();
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Preset
+// Description: Loads the integrator so the next Compute continues from Ut (bumpless transfer)
+// Arguments:   Ut - Control action to continue from
+//              Y - Current measurement (not used - states are set with SetState)
+// Returns:     None
+
+void Lqr::Preset(float Ut, float Y)
+{
+    (void)Y;
+
+    _Data.Ut_nxt = Ut;
+    _Data.Saturated = false;
+
+    // Pure state feedback has no memory - Only the LQI integrator can absorb the difference
+    float Ki = _Data.K[_StateCount];
+
+    if ((_Data.Integral == LQR_NO_INTEGRAL) || (Ki == 0))
+        return;
+
+    float Ut_fb = 0;
+
+    for (uint8_t Idx = 0; Idx < _StateCount; Idx++)
+        Ut_fb += _Data.K[Idx] * (_Data.Ref[Idx] - _Data.State[Idx]);
+
+    // Ut = Ut_fb - Ki z (one division)
+    _Data.State[_StateCount] = (Ut_fb - Ut) / Ki;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
@@ -23,11 +23,15 @@ extern "C"
 // Standard libraries
 #include <stdint.h>
 
+// Controller telemetry
+#include "Telemetry_TivaC.hpp"
+
 // ------------------------------------------------------------------------------------------------------- //
 // Definitions
 // ------------------------------------------------------------------------------------------------------- //
 
-#define MAX_LQR_STATES 10               // Define the maximum number of states
+#define MAX_LQR_STATES 10               // Define the maximum number of states (integrator included)
+#define LQR_NO_INTEGRAL 0xFF            // Integral action disabled
 
 // ------------------------------------------------------------------------------------------------------- //
 // Structs
@@ -43,6 +47,9 @@ typedef struct
     float Ut_nxt;                       // Control action (sample k + 1)
     float Ut_min;                       // Minimum output value
     float Ut_max;                       // Maximum output value
+    bool Saturated;                     // Saturation flag
+    bool Hold;                          // Integrator hold flag (LQI mode)
+    uint8_t Integral;                   // Index of the integrated state (LQR_NO_INTEGRAL = disabled)
 } lqr_t;
 
 // LQR controller variables - Default values
@@ -54,6 +61,9 @@ typedef struct
     .Ut_nxt = 0, \
     .Ut_min = 0, \
     .Ut_max = 0, \
+    .Saturated = false, \
+    .Hold = false, \
+    .Integral = LQR_NO_INTEGRAL, \
 }
 
 // ------------------------------------------------------------------------------------------------------- //
@@ -74,6 +84,13 @@ class Lqr
         // Number of states
         uint8_t _StateCount = 0;
 
+        // Number of gains (states and integrator)
+        uint8_t _GainCount = 0;
+
+        // Telemetry id
+        uint8_t _TelemetryId = 0;
+        uint8_t _TelemetryChannel = 0;
+
     // --------------------------------------------------------------------------------------------------- //
     // Public members
     // --------------------------------------------------------------------------------------------------- //
@@ -113,6 +130,18 @@ class Lqr
         // Returns:     None
         void SetGain(uint8_t StateIndex, float NewGain);
 
+        // Name:        SetGains
+        // Description: Sets the gains of all states (and of the integrator in LQI mode)
+        // Arguments:   Gains - The gain vector (one value per state, then the integrator gain)
+        // Returns:     None
+        void SetGains(const float *Gains);
+
+        // Name:        GetGainCount
+        // Description: Gets the number of gains (states, plus the integrator in LQI mode)
+        // Arguments:   None
+        // Returns:     Number of values SetGains reads
+        uint8_t GetGainCount();
+
         // Name:        SetReference
         // Description: Sets the reference associated to one state
         // Arguments:   StateIndex - Index of the state associated with the new value
@@ -120,6 +149,12 @@ class Lqr
         // Returns:     None
         void SetReference(uint8_t StateIndex, float NewReference);
 
+        // Name:        SetReferences
+        // Description: Sets the references of all states
+        // Arguments:   Refs - The reference vector (one value per state)
+        // Returns:     None
+        void SetReferences(const float *Refs);
+
         // Name:        GetReference
         // Description: Gets the reference associated to one state
         // Arguments:   StateIndex - Index of the state associated with the new value
@@ -133,12 +168,48 @@ class Lqr
         // Returns:     None
         void SetState(uint8_t StateIndex, float NewState);
 
+        // Name:        SetStates
+        // Description: Sets the values of all states
+        // Arguments:   States - The state vector (one value per state)
+        // Returns:     None
+        void SetStates(const float *States);
+
         // Name:        GetState
         // Description: Gets the value of one state
         // Arguments:   StateIndex - Index of the state
         // Returns:     The state value
         float GetState(uint8_t StateIndex);
+
+        // Name:        GetStateBuffer
+        // Description: Gets the state array, so an observer can write its estimate in place
+        // Arguments:   None
+        // Returns:     Pointer to the state values (MAX_LQR_STATES values)
+        float *GetStateBuffer();
         
+        // Name:        SetIntegral
+        // Description: Enables the LQI mode - Integral action on the error of one state
+        // Arguments:   StateIndex - Index of the integrated state (LQR_NO_INTEGRAL = disable)
+        // Returns:     True if the mode was set, false if there is no room for the integrator
+        bool SetIntegral(uint8_t StateIndex);
+
+        // Name:        SetIntegrator
+        // Description: Sets the integrator value (LQI mode)
+        // Arguments:   NewValue - The integrator value
+        // Returns:     None
+        void SetIntegrator(float NewValue);
+
+        // Name:        GetIntegrator
+        // Description: Gets the integrator value (LQI mode)
+        // Arguments:   None
+        // Returns:     The integrator value
+        float GetIntegrator();
+
+        // Name:        SetHold
+        // Description: Freezes or releases the integrator (LQI mode, e.g. while an inner loop is saturated)
+        // Arguments:   Hold - True to freeze the integrator
+        // Returns:     None
+        void SetHold(bool Hold);
+
         // Name:        SetLimits
         // Description: Sets the controller output limits
         // Arguments:   Ut_min - Minimum output value
@@ -152,11 +223,37 @@ class Lqr
         // Returns:     None
         void GetLimits(float *Buffer);
 
+        // Name:        GetSaturated
+        // Description: Gets the saturation flag of the last sample
+        // Arguments:   None
+        // Returns:     True if the output was limited in the last sample
+        bool GetSaturated();
+
+        // Name:        SetTelemetryId
+        // Description: Sets the id written in the telemetry records of this controller and its ring
+        // Arguments:   Id - Controller id
+        //              Channel - Telemetry ring (0 to TELEMETRY_CHANNELS - 1, one per ISR priority)
+        // Returns:     None
+        void SetTelemetryId(uint8_t Id, uint8_t Channel = 0);
+
         // Name:        Compute
         // Description: Computes the control action
         // Arguments:   None
         // Returns:     The new control action
         float Compute();
+
+        // Name:        Compute
+        // Description: Sets the values of all states and computes the control action
+        // Arguments:   States - The state vector (one value per state)
+        // Returns:     The new control action
+        float Compute(const float *States);
+
+        // Name:        Preset
+        // Description: Loads the integrator so the next Compute continues from Ut (bumpless transfer)
+        // Arguments:   Ut - Control action to continue from
+        //              Y - Current measurement (not used - states are set with SetState)
+        // Returns:     None
+        void Preset(float Ut, float Y);
 };
 
 // ------------------------------------------------------------------------------------------------------- //
@@ -0,0 +1,330 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// State observer library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      Observer<N, P> estimates the N states of a discrete single-input system
+//          x[k + 1] = A x[k] + B u[k],    y[k] = C x[k]          (P measured outputs)
+//      with a current estimator (predict with the model, correct with the new measurement):
+//          Predict:    x- = A x^[k - 1] + B u[k - 1]
+//          Correct:    x^[k] = x- + L (y[k] - C x-)
+//      Both steps are folded into constant matrices when the model is set:
+//          F = (I - L C) A,    G = (I - L C) B
+//          x^[k] = F x^[k - 1] + G u[k - 1] + L y[k]
+//      so one Update costs N (N + P + 1) multiply-accumulates (24 for 4 states and 1 output).
+
+//      L is either given (Luenberger design) or computed by SetKalman as the steady-state Kalman gain
+//      for process noise covariance Qn and measurement noise variance Rn (single output), using the
+//      Dare solver on the dual problem (A', C'):
+//          L = M C' (C M C' + Rn)^-1,    M = a priori error covariance
+
+//      Attach points the estimate at the state array of a Lqr, LqrN or LqrMimo, so Update writes the
+//      states the controller reads on its next Compute and no SetState call is needed.
+
+//      Usage example (position measured, 3 states estimated):
+//          Observer<3, 1> Estimator;
+//          Estimator.SetModel(&A[0][0], B, C, L);
+//          Estimator.Attach(&Controller);
+//          ...
+//          Estimator.Update(&Position, U);     // U = control action of the previous sample
+//          U = Controller.Compute();
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef OBSERVER_TIVAC_H_
+#define OBSERVER_TIVAC_H_
+
+// Templates must have C++ linkage
+#ifdef __cplusplus
+extern "C++"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// DARE solver
+#include "Dare_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#define OBSERVER_DARE_ITERATIONS 50     // Iteration limit of the Kalman gain design
+#define OBSERVER_DARE_TOLERANCE 1e-6f   // Relative tolerance of the Kalman gain design
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N, uint8_t P>
+class Observer
+{
+    static_assert(N >= 1, "Observer needs at least one state");
+    static_assert(P >= 1, "Observer needs at least one output");
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        float _F[N][N] = {{0}};         // (I - L C) A
+        float _G[N] = {0};              // (I - L C) B
+        float _L[N][P] = {{0}};         // Observer gain
+        float _Own[N] = {0};            // Estimate storage when not attached
+        float *_X = _Own;               // Estimate (sample k)
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        SetModel
+        // Description: Sets the model and gain and precomputes the update matrices
+        // Arguments:   A - State matrix (N x N, row-major)
+        //              B - Input vector (N values)
+        //              C - Output matrix (P x N, row-major)
+        //              L - Observer gain (N x P, row-major)
+        // Returns:     None
+        void SetModel(const float *A, const float *B, const float *C, const float *L);
+
+        // Name:        SetKalman
+        // Description: Computes the steady-state Kalman gain and sets the model (single output, blocking)
+        // Arguments:   A - State matrix (N x N, row-major)
+        //              B - Input vector (N values)
+        //              C - Output vector (N values)
+        //              Qn - Process noise covariance (N x N, row-major)
+        //              Rn - Measurement noise variance
+        //              Solver - DARE solver used for the design
+        // Returns:     True if the gain was computed, false otherwise
+        bool SetKalman(const float *A, const float *B, const float *C, const float *Qn, float Rn, Dare *Solver);
+
+        // Name:        GetGain
+        // Description: Gets one element of the observer gain
+        // Arguments:   StateIndex - Index of the state (row)
+        //              Output - Index of the output (column)
+        // Returns:     The gain value
+        float GetGain(uint8_t StateIndex, uint8_t Output);
+
+        // Name:        Attach
+        // Description: Writes the estimate to an external state array
+        // Arguments:   States - State array (N values, nullptr = internal storage)
+        // Returns:     None
+        void Attach(float *States);
+
+        // Name:        Attach
+        // Description: Writes the estimate to the state array of a controller (Lqr, LqrN or LqrMimo)
+        // Arguments:   Controller - Controller that reads the estimate
+        // Returns:     None
+        template <class Ctrl>
+        void Attach(Ctrl *Controller);
+
+        // Name:        Reset
+        // Description: Sets the estimate
+        // Arguments:   States - Initial estimate (N values, nullptr = zeros)
+        // Returns:     None
+        void Reset(const float *States);
+
+        // Name:        GetEstimate
+        // Description: Gets one estimated state
+        // Arguments:   StateIndex - Index of the state
+        // Returns:     The estimated value
+        float GetEstimate(uint8_t StateIndex);
+
+        // Name:        Update
+        // Description: Predicts with the last control action and corrects with the new measurement
+        // Arguments:   Y - Measured outputs (P values, sample k)
+        //              U - Control action applied in the previous sample
+        // Returns:     None
+        void Update(const float *Y, float U);
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N, uint8_t P>
+void Observer<N, P>::SetModel(const float *A, const float *B, const float *C, const float *L)
+{
+    // I - L C
+    float M[N][N];
+
+    for (uint8_t Row = 0; Row < N; Row++)
+    {
+        for (uint8_t Col = 0; Col < N; Col++)
+        {
+            float Acc = (Row == Col) ? 1.0f : 0.0f;
+
+            for (uint8_t Out = 0; Out < P; Out++)
+                Acc -= L[Row * P + Out] * C[Out * N + Col];
+
+            M[Row][Col] = Acc;
+        }
+    }
+
+    // F = (I - L C) A, G = (I - L C) B
+    for (uint8_t Row = 0; Row < N; Row++)
+    {
+        float AccG = 0;
+
+        for (uint8_t Col = 0; Col < N; Col++)
+        {
+            float AccF = 0;
+
+            for (uint8_t Idx = 0; Idx < N; Idx++)
+                AccF += M[Row][Idx] * A[Idx * N + Col];
+
+            _F[Row][Col] = AccF;
+            AccG += M[Row][Col] * B[Col];
+        }
+
+        _G[Row] = AccG;
+
+        for (uint8_t Out = 0; Out < P; Out++)
+            _L[Row][Out] = L[Row * P + Out];
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N, uint8_t P>
+bool Observer<N, P>::SetKalman(const float *A, const float *B, const float *C, const float *Qn, float Rn,
+                               Dare *Solver)
+{
+    static_assert(P == 1, "SetKalman supports a single output");
+    static_assert(N <= MAX_DARE_STATES, "SetKalman supports up to MAX_DARE_STATES states");
+
+    if ((Solver == nullptr) || (Rn <= 0))
+        return false;
+
+    // Dual problem - A' and C'
+    float At[N][N];
+
+    for (uint8_t Row = 0; Row < N; Row++)
+        for (uint8_t Col = 0; Col < N; Col++)
+            At[Row][Col] = A[Col * N + Row];
+
+    if (!Solver->Init(&At[0][0], C, Qn, Rn, N, OBSERVER_DARE_ITERATIONS, OBSERVER_DARE_TOLERANCE))
+        return false;
+
+    if (Solver->Solve() != DARE_DONE)
+        return false;
+
+    // L = M C' / (C M C' + Rn)
+    float L[N];
+    float S = Rn;
+
+    for (uint8_t Row = 0; Row < N; Row++)
+    {
+        float Acc = 0;
+
+        for (uint8_t Col = 0; Col < N; Col++)
+            Acc += Solver->GetSolution(Row, Col) * C[Col];
+
+        L[Row] = Acc;
+        S += C[Row] * Acc;
+    }
+
+    float Inv = 1.0f / S;
+
+    for (uint8_t Row = 0; Row < N; Row++)
+        L[Row] *= Inv;
+
+    SetModel(A, B, C, L);
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N, uint8_t P>
+float Observer<N, P>::GetGain(uint8_t StateIndex, uint8_t Output)
+{
+    if ((StateIndex < N) && (Output < P))
+        return _L[StateIndex][Output];
+
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N, uint8_t P>
+void Observer<N, P>::Attach(float *States)
+{
+    _X = (States != nullptr) ? States : _Own;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N, uint8_t P>
+template <class Ctrl>
+void Observer<N, P>::Attach(Ctrl *Controller)
+{
+    Attach((Controller != nullptr) ? Controller->GetStateBuffer() : nullptr);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N, uint8_t P>
+void Observer<N, P>::Reset(const float *States)
+{
+    for (uint8_t Idx = 0; Idx < N; Idx++)
+        _X[Idx] = (States != nullptr) ? States[Idx] : 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N, uint8_t P>
+float Observer<N, P>::GetEstimate(uint8_t StateIndex)
+{
+    if (StateIndex < N)
+        return _X[StateIndex];
+
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N, uint8_t P>
+inline void Observer<N, P>::Update(const float *Y, float U)
+{
+    // Every new state depends on all old states - Results are held until the last row is done
+    float Next[N];
+
+    for (uint8_t Row = 0; Row < N; Row++)
+    {
+        float Acc = _G[Row] * U;
+
+        for (uint8_t Col = 0; Col < N; Col++)
+            Acc += _F[Row][Col] * _X[Col];
+
+        for (uint8_t Out = 0; Out < P; Out++)
+            Acc += _L[Row][Out] * Y[Out];
+
+        Next[Row] = Acc;
+    }
+
+    for (uint8_t Row = 0; Row < N; Row++)
+        _X[Row] = Next[Row];
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
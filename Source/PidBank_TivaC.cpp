@@ -0,0 +1,381 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// PID controller bank library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// PID bank defines and macros
+#include "PidBank_TivaC.hpp"
+
+// Standard libraries
+#include <stdint.h>
+
+// Host SIMD intrinsics
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Local functions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _ComputeOne
+// Description: Computes the control action of one controller (same operation order as Pid::Compute)
+// Arguments:   Data - PID bank data
+//              Idx - Index of the controller
+//              Y - Current system output
+// Returns:     The new control action
+
+static inline float _ComputeOne(pid_bank_t *Data, uint8_t Idx, float Y)
+{
+    // Error - Sample k
+    float E_now = Data->Ref[Idx] - Y;
+
+    // Integral portion - Anti windup
+    if (Data->Saturated[Idx] == 0)
+        Data->Ui_int[Idx] += Data->Ki[Idx] * E_now;
+
+    // Derivative error - Derivative on measurement
+    float E_der = Data->Y_lst[Idx] - Y;
+
+    // Rotate buffer
+    Data->Y_lst[Idx] = Y;
+
+    // Proportional, integral and derivative portions - Sample k + 1
+    float Up_nxt = E_now * Data->Kp[Idx];
+    float Ui_nxt = Data->Ui_int[Idx];
+    float Ud_nxt = E_der * Data->Kd[Idx];
+
+    // Total control action - Sample k + 1
+    float Ut_nxt = (Up_nxt + Ui_nxt + Ud_nxt);
+
+    // Limiter - Maximum output exceeded
+    if (Ut_nxt >= Data->Ut_max[Idx])
+    {
+        Ut_nxt = Data->Ut_max[Idx];
+        Data->Saturated[Idx] = 0xFFFFFFFF;
+    }
+
+    // Limiter - Minimum output exceeded
+    else if (Ut_nxt <= Data->Ut_min[Idx])
+    {
+        Ut_nxt = Data->Ut_min[Idx];
+        Data->Saturated[Idx] = 0xFFFFFFFF;
+    }
+
+    // Limiter - Between limits
+    else
+        Data->Saturated[Idx] = 0;
+
+    return Ut_nxt;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        PidBank
+// Description: Constructor of the class with no arguments
+// Arguments:   None
+// Returns:     None
+
+PidBank::PidBank()
+{
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        PidBank
+// Description: Constructor of the class with the number of controllers
+// Arguments:   Count - Number of controllers in the bank
+// Returns:     None
+
+PidBank::PidBank(uint8_t Count)
+{
+    Init(Count);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Init
+// Description: Sets the number of controllers and resets all of them
+// Arguments:   Count - Number of controllers in the bank
+// Returns:     None
+
+void PidBank::Init(uint8_t Count)
+{
+    if (Count <= MAX_PID_BANK)
+    {
+        _Data = pid_bank_t_default;
+        _Count = Count;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetCount
+// Description: Gets the number of controllers
+// Arguments:   None
+// Returns:     Number of controllers in the bank
+
+uint8_t PidBank::GetCount()
+{
+    return _Count;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetGains
+// Description: Sets the gains of one controller
+// Arguments:   Idx - Index of the controller
+//              Kp - Proportional gain
+//              Ki - Integral gain
+//              Kd - Derivative gain
+// Returns:     None
+
+void PidBank::SetGains(uint8_t Idx, const float Kp, const float Ki, const float Kd)
+{
+    if (Idx < _Count)
+    {
+        _Data.Kp[Idx] = Kp;
+        _Data.Ki[Idx] = Ki;
+        _Data.Kd[Idx] = Kd;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetGains
+// Description: Gets the gains of one controller
+// Arguments:   Idx - Index of the controller
+//              Buffer - Buffer to receive the values
+// Returns:     None
+
+void PidBank::GetGains(uint8_t Idx, float *Buffer)
+{
+    if (Idx < _Count)
+    {
+        Buffer[0] = _Data.Kp[Idx];
+        Buffer[1] = _Data.Ki[Idx];
+        Buffer[2] = _Data.Kd[Idx];
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetReference
+// Description: Sets the reference of one controller
+// Arguments:   Idx - Index of the controller
+//              NewReference - The reference value
+// Returns:     None
+
+void PidBank::SetReference(uint8_t Idx, float NewReference)
+{
+    if (Idx < _Count)
+        _Data.Ref[Idx] = NewReference;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetReference
+// Description: Gets the reference of one controller
+// Arguments:   Idx - Index of the controller
+// Returns:     The reference value
+
+float PidBank::GetReference(uint8_t Idx)
+{
+    if (Idx < _Count)
+        return _Data.Ref[Idx];
+
+    return 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetLimits
+// Description: Sets the output limits of one controller
+// Arguments:   Idx - Index of the controller
+//              Ut_min - Minimum output value
+//              Ut_max - Maximum output value
+// Returns:     None
+
+void PidBank::SetLimits(uint8_t Idx, const float Ut_min, const float Ut_max)
+{
+    if (Idx < _Count)
+    {
+        _Data.Ut_min[Idx] = Ut_min;
+        _Data.Ut_max[Idx] = Ut_max;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetLimits
+// Description: Gets the output limits of one controller
+// Arguments:   Idx - Index of the controller
+//              Buffer - Buffer to receive the values
+// Returns:     None
+
+void PidBank::GetLimits(uint8_t Idx, float *Buffer)
+{
+    if (Idx < _Count)
+    {
+        Buffer[0] = _Data.Ut_min[Idx];
+        Buffer[1] = _Data.Ut_max[Idx];
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetSaturated
+// Description: Gets the saturation flag of one controller
+// Arguments:   Idx - Index of the controller
+// Returns:     True if the last output of the controller was saturated
+
+bool PidBank::GetSaturated(uint8_t Idx)
+{
+    if (Idx < _Count)
+        return (_Data.Saturated[Idx] != 0);
+
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Compute
+// Description: Computes the control action of all controllers
+// Arguments:   Y - Current system outputs (one per controller)
+//              Ut - Buffer to receive the new control actions (one per controller)
+// Returns:     None
+
+void PidBank::Compute(const float *Y, float *Ut)
+{
+    uint8_t Idx = 0;
+
+#if defined(__AVX__)
+
+    // Host path - 8 controllers per iteration
+    for (; (Idx + 8) <= _Count; Idx += 8)
+    {
+        __m256 Y_now = _mm256_loadu_ps(&Y[Idx]);
+        __m256 Sat = _mm256_loadu_ps((const float *)&_Data.Saturated[Idx]);
+
+        // Error - Sample k
+        __m256 E_now = _mm256_sub_ps(_mm256_loadu_ps(&_Data.Ref[Idx]), Y_now);
+
+        // Integral portion - Anti windup (keep old value where saturated)
+        __m256 Ui_int = _mm256_loadu_ps(&_Data.Ui_int[Idx]);
+        __m256 Ui_new = _mm256_add_ps(Ui_int, _mm256_mul_ps(_mm256_loadu_ps(&_Data.Ki[Idx]), E_now));
+        Ui_int = _mm256_blendv_ps(Ui_new, Ui_int, Sat);
+        _mm256_storeu_ps(&_Data.Ui_int[Idx], Ui_int);
+
+        // Derivative error - Derivative on measurement
+        __m256 E_der = _mm256_sub_ps(_mm256_loadu_ps(&_Data.Y_lst[Idx]), Y_now);
+
+        // Rotate buffer
+        _mm256_storeu_ps(&_Data.Y_lst[Idx], Y_now);
+
+        // Total control action - Sample k + 1
+        __m256 Ut_nxt = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(E_now, _mm256_loadu_ps(&_Data.Kp[Idx])),
+                                                    Ui_int),
+                                      _mm256_mul_ps(E_der, _mm256_loadu_ps(&_Data.Kd[Idx])));
+
+        // Limiter - Maximum has priority over minimum, NaN is passed through as in Pid::Compute
+        __m256 Max = _mm256_loadu_ps(&_Data.Ut_max[Idx]);
+        __m256 Min = _mm256_loadu_ps(&_Data.Ut_min[Idx]);
+        __m256 AboveMax = _mm256_cmp_ps(Ut_nxt, Max, _CMP_GE_OQ);
+        __m256 BelowMin = _mm256_andnot_ps(AboveMax, _mm256_cmp_ps(Ut_nxt, Min, _CMP_LE_OQ));
+        Ut_nxt = _mm256_blendv_ps(Ut_nxt, Max, AboveMax);
+        Ut_nxt = _mm256_blendv_ps(Ut_nxt, Min, BelowMin);
+
+        _mm256_storeu_ps((float *)&_Data.Saturated[Idx], _mm256_or_ps(AboveMax, BelowMin));
+        _mm256_storeu_ps(&Ut[Idx], Ut_nxt);
+    }
+
+#elif defined(__SSE__)
+
+    // Host path - 4 controllers per iteration
+    for (; (Idx + 4) <= _Count; Idx += 4)
+    {
+        __m128 Y_now = _mm_loadu_ps(&Y[Idx]);
+        __m128 Sat = _mm_loadu_ps((const float *)&_Data.Saturated[Idx]);
+
+        // Error - Sample k
+        __m128 E_now = _mm_sub_ps(_mm_loadu_ps(&_Data.Ref[Idx]), Y_now);
+
+        // Integral portion - Anti windup (keep old value where saturated)
+        __m128 Ui_int = _mm_loadu_ps(&_Data.Ui_int[Idx]);
+        __m128 Ui_new = _mm_add_ps(Ui_int, _mm_mul_ps(_mm_loadu_ps(&_Data.Ki[Idx]), E_now));
+        Ui_int = _mm_or_ps(_mm_and_ps(Sat, Ui_int), _mm_andnot_ps(Sat, Ui_new));
+        _mm_storeu_ps(&_Data.Ui_int[Idx], Ui_int);
+
+        // Derivative error - Derivative on measurement
+        __m128 E_der = _mm_sub_ps(_mm_loadu_ps(&_Data.Y_lst[Idx]), Y_now);
+
+        // Rotate buffer
+        _mm_storeu_ps(&_Data.Y_lst[Idx], Y_now);
+
+        // Total control action - Sample k + 1
+        __m128 Ut_nxt = _mm_add_ps(_mm_add_ps(_mm_mul_ps(E_now, _mm_loadu_ps(&_Data.Kp[Idx])),
+                                              Ui_int),
+                                   _mm_mul_ps(E_der, _mm_loadu_ps(&_Data.Kd[Idx])));
+
+        // Limiter - Maximum has priority over minimum, NaN is passed through as in Pid::Compute
+        __m128 Max = _mm_loadu_ps(&_Data.Ut_max[Idx]);
+        __m128 Min = _mm_loadu_ps(&_Data.Ut_min[Idx]);
+        __m128 AboveMax = _mm_cmpge_ps(Ut_nxt, Max);
+        __m128 BelowMin = _mm_andnot_ps(AboveMax, _mm_cmple_ps(Ut_nxt, Min));
+        __m128 Sat_nxt = _mm_or_ps(AboveMax, BelowMin);
+        Ut_nxt = _mm_or_ps(_mm_andnot_ps(Sat_nxt, Ut_nxt), _mm_or_ps(_mm_and_ps(AboveMax, Max), _mm_and_ps(BelowMin, Min)));
+
+        _mm_storeu_ps((float *)&_Data.Saturated[Idx], Sat_nxt);
+        _mm_storeu_ps(&Ut[Idx], Ut_nxt);
+    }
+
+#else
+
+    // Target path - 2 controllers per iteration (independent dependency chains for the FPU pipeline)
+    for (; (Idx + 2) <= _Count; Idx += 2)
+    {
+        float Ut_0 = _ComputeOne(&_Data, Idx, Y[Idx]);
+        float Ut_1 = _ComputeOne(&_Data, Idx + 1, Y[Idx + 1]);
+
+        Ut[Idx] = Ut_0;
+        Ut[Idx + 1] = Ut_1;
+    }
+
+#endif
+
+    // Remaining controllers
+    for (; Idx < _Count; Idx++)
+        Ut[Idx] = _ComputeOne(&_Data, Idx, Y[Idx]);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Reset
+// Description: Resets the state of all controllers (gains, references and limits are kept)
+// Arguments:   None
+// Returns:     None
+
+void PidBank::Reset()
+{
+    for (uint8_t Idx = 0; Idx < MAX_PID_BANK; Idx++)
+    {
+        _Data.Y_lst[Idx] = 0;
+        _Data.Ui_int[Idx] = 0;
+        _Data.Saturated[Idx] = 0;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------- //
@@ -0,0 +1,200 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// PID controller bank library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      This library computes several PID controllers in a single call. The controller variables are
+//      stored as a structure of arrays (one array per variable, indexed by controller), so the compute
+//      loop walks contiguous memory and can be vectorized. Only the values that carry state between
+//      samples are kept (integral error, last output and saturation flag); intermediate results are
+//      held in registers.
+
+//      The control law is the same as the one used by the Pid class (derivative on measurement and
+//      integral freeze on saturation) and the floating-point operations are performed in the same
+//      order, so each output matches Pid::Compute bit-for-bit for the same inputs.
+
+//      Compute paths:
+//          - AVX (8 controllers per iteration) when compiled with __AVX__
+//          - SSE (4 controllers per iteration) when compiled with __SSE__
+//          - 2-way unrolled scalar path otherwise (Cortex-M4F)
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef PIDBANK_TIVAC_H_
+#define PIDBANK_TIVAC_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#define MAX_PID_BANK 32                 // Maximum number of controllers in a bank (multiple of 8)
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// PID bank variables (structure of arrays)
+typedef struct
+{
+    float Ref[MAX_PID_BANK];            // Setpoint
+    float Y_lst[MAX_PID_BANK];          // Output (sample k - 1) -> Derivative on measurement
+    float Ui_int[MAX_PID_BANK];         // Control action - Integral portion, accumulated (sum of Ki * E)
+    uint32_t Saturated[MAX_PID_BANK];   // Saturation mask (0xFFFFFFFF = saturated, 0 = not saturated)
+    float Kp[MAX_PID_BANK];             // Proportional gain
+    float Ki[MAX_PID_BANK];             // Integral gain
+    float Kd[MAX_PID_BANK];             // Derivative gain
+    float Ut_min[MAX_PID_BANK];         // Minimum output value
+    float Ut_max[MAX_PID_BANK];         // Maximum output value
+} pid_bank_t;
+
+// PID bank variables - Default values
+#define pid_bank_t_default { \
+    .Ref = {0}, \
+    .Y_lst = {0}, \
+    .Ui_int = {0}, \
+    .Saturated = {0}, \
+    .Kp = {0}, \
+    .Ki = {0}, \
+    .Kd = {0}, \
+    .Ut_min = {0}, \
+    .Ut_max = {0}, \
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+class PidBank
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        // PID bank data
+        pid_bank_t _Data = pid_bank_t_default;
+
+        // Number of controllers
+        uint8_t _Count = 0;
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        PidBank
+        // Description: Constructor of the class with no arguments
+        // Arguments:   None
+        // Returns:     None
+        PidBank();
+
+        // Name:        PidBank
+        // Description: Constructor of the class with the number of controllers
+        // Arguments:   Count - Number of controllers in the bank
+        // Returns:     None
+        PidBank(uint8_t Count);
+
+        // Name:        Init
+        // Description: Sets the number of controllers and resets all of them
+        // Arguments:   Count - Number of controllers in the bank
+        // Returns:     None
+        void Init(uint8_t Count);
+
+        // Name:        GetCount
+        // Description: Gets the number of controllers
+        // Arguments:   None
+        // Returns:     Number of controllers in the bank
+        uint8_t GetCount();
+
+        // Name:        SetGains
+        // Description: Sets the gains of one controller
+        // Arguments:   Idx - Index of the controller
+        //              Kp - Proportional gain
+        //              Ki - Integral gain
+        //              Kd - Derivative gain
+        // Returns:     None
+        void SetGains(uint8_t Idx, const float Kp, const float Ki, const float Kd);
+
+        // Name:        GetGains
+        // Description: Gets the gains of one controller
+        // Arguments:   Idx - Index of the controller
+        //              Buffer - Buffer to receive the values
+        // Returns:     None
+        void GetGains(uint8_t Idx, float *Buffer);
+
+        // Name:        SetReference
+        // Description: Sets the reference of one controller
+        // Arguments:   Idx - Index of the controller
+        //              NewReference - The reference value
+        // Returns:     None
+        void SetReference(uint8_t Idx, float NewReference);
+
+        // Name:        GetReference
+        // Description: Gets the reference of one controller
+        // Arguments:   Idx - Index of the controller
+        // Returns:     The reference value
+        float GetReference(uint8_t Idx);
+
+        // Name:        SetLimits
+        // Description: Sets the output limits of one controller
+        // Arguments:   Idx - Index of the controller
+        //              Ut_min - Minimum output value
+        //              Ut_max - Maximum output value
+        // Returns:     None
+        void SetLimits(uint8_t Idx, const float Ut_min, const float Ut_max);
+
+        // Name:        GetLimits
+        // Description: Gets the output limits of one controller
+        // Arguments:   Idx - Index of the controller
+        //              Buffer - Buffer to receive the values
+        // Returns:     None
+        void GetLimits(uint8_t Idx, float *Buffer);
+
+        // Name:        GetSaturated
+        // Description: Gets the saturation flag of one controller
+        // Arguments:   Idx - Index of the controller
+        // Returns:     True if the last output of the controller was saturated
+        bool GetSaturated(uint8_t Idx);
+
+        // Name:        Compute
+        // Description: Computes the control action of all controllers
+        // Arguments:   Y - Current system outputs (one per controller)
+        //              Ut - Buffer to receive the new control actions (one per controller)
+        // Returns:     None
+        void Compute(const float *Y, float *Ut);
+
+        // Name:        Reset
+        // Description: Resets the state of all controllers (gains, references and limits are kept)
+        // Arguments:   None
+        // Returns:     None
+        void Reset();
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
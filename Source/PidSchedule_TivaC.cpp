@@ -0,0 +1,153 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// PID gain schedule library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// PID gain schedule defines and macros
+#include "PidSchedule_TivaC.hpp"
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        PidSchedule
+// Description: Constructor of the class with no arguments
+// Arguments:   None
+// Returns:     None
+
+PidSchedule::PidSchedule()
+{
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        PidSchedule
+// Description: Constructor of the class with the gain table and scheduling range
+// Arguments:   Table - Gains at each breakpoint
+//              Count - Number of breakpoints (2 to MAX_PID_SCHEDULE_POINTS)
+//              X_min - Scheduling variable at the first breakpoint
+//              X_max - Scheduling variable at the last breakpoint
+// Returns:     None
+
+PidSchedule::PidSchedule(const pid_gains_t *Table, uint8_t Count, float X_min, float X_max)
+{
+    Init(Table, Count, X_min, X_max);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Init
+// Description: Sets the gain table and scheduling range
+// Arguments:   Table - Gains at each breakpoint
+//              Count - Number of breakpoints (2 to MAX_PID_SCHEDULE_POINTS)
+//              X_min - Scheduling variable at the first breakpoint
+//              X_max - Scheduling variable at the last breakpoint (must be greater than X_min)
+// Returns:     True if the table was accepted, false otherwise
+
+bool PidSchedule::Init(const pid_gains_t *Table, uint8_t Count, float X_min, float X_max)
+{
+    // Invalid table
+    if ((Table == nullptr) || (Count < 2) || (Count > MAX_PID_SCHEDULE_POINTS) || (X_max <= X_min))
+        return false;
+
+    for (uint8_t Idx = 0; Idx < Count; Idx++)
+        _Data.Table[Idx] = Table[Idx];
+
+    _Data.Count = Count;
+    _Data.X_min = X_min;
+    _Data.X_max = X_max;
+
+    // Inverse of the breakpoint spacing - The only division
+    _Data.InvDx = (float)(Count - 1) / (X_max - X_min);
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetPoint
+// Description: Sets the gains at one breakpoint
+// Arguments:   Idx - Index of the breakpoint
+//              Gains - The gains
+// Returns:     None
+
+void PidSchedule::SetPoint(uint8_t Idx, const pid_gains_t *Gains)
+{
+    if ((Idx < _Data.Count) && (Gains != nullptr))
+        _Data.Table[Idx] = *Gains;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Lookup
+// Description: Interpolates the gains for a value of the scheduling variable
+// Arguments:   X - Scheduling variable
+//              Gains - pid_gains_t struct to receive the gains
+// Returns:     None
+
+void PidSchedule::Lookup(float X, pid_gains_t *Gains)
+{
+    // Position in the table (breakpoint units)
+    float Pos = (X - _Data.X_min) * _Data.InvDx;
+
+    // Below the first breakpoint (or X is NaN)
+    if (!(Pos > 0))
+    {
+        *Gains = _Data.Table[0];
+        return;
+    }
+
+    // Above the last breakpoint
+    if (Pos >= (float)(_Data.Count - 1))
+    {
+        *Gains = _Data.Table[_Data.Count - 1];
+        return;
+    }
+
+    // Segment and fraction
+    uint8_t Idx = (uint8_t)Pos;
+    float Frac = Pos - (float)Idx;
+
+    const pid_gains_t *Lo = &_Data.Table[Idx];
+    const pid_gains_t *Hi = &_Data.Table[Idx + 1];
+
+    // Linear interpolation
+    Gains->Kp = Lo->Kp + Frac * (Hi->Kp - Lo->Kp);
+    Gains->Ki = Lo->Ki + Frac * (Hi->Ki - Lo->Ki);
+    Gains->Kd = Lo->Kd + Frac * (Hi->Kd - Lo->Kd);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Update
+// Description: Interpolates the gains and applies them to a controller
+// Arguments:   Controller - Controller to be updated
+//              X - Scheduling variable
+// Returns:     None
+
+void PidSchedule::Update(Pid *Controller, float X)
+{
+    // Empty table
+    if ((Controller == nullptr) || (_Data.Count == 0))
+        return;
+
+    pid_gains_t Gains;
+    Lookup(X, &Gains);
+
+    // Integral portion is stored as Ki * E - Bumpless without rescaling
+    Controller->SetGains(Gains.Kp, Gains.Ki, Gains.Kd);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
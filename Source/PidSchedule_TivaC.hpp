@@ -0,0 +1,154 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// PID gain schedule library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      This library holds a table of PID gains (Kp, Ki, Kd) at uniformly spaced breakpoints of a
+//      scheduling variable X and linearly interpolates between them. The breakpoint spacing is
+//      inverted once in Init, so a lookup is one subtraction, one multiplication, a truncation and
+//      three interpolations: constant time and no division.
+
+//      Update feeds the interpolated gains straight into a Pid object with Pid::SetGains. Gain changes
+//      are bumpless for the integral portion: Pid accumulates Ki * E, not E, so a new Ki only weights
+//      the following errors. The proportional and derivative portions follow the new gains at once.
+
+//      Values of X outside [X_min, X_max] use the first or last breakpoint (NaN uses the first).
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef PIDSCHEDULE_TIVAC_H_
+#define PIDSCHEDULE_TIVAC_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// PID controller
+#include "Pid_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#define MAX_PID_SCHEDULE_POINTS 16      // Maximum number of breakpoints
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// PID gains
+typedef struct
+{
+    float Kp;                           // Proportional gain
+    float Ki;                           // Integral gain
+    float Kd;                           // Derivative gain
+} pid_gains_t;
+
+// PID gain schedule variables
+typedef struct
+{
+    pid_gains_t Table[MAX_PID_SCHEDULE_POINTS]; // Gains at each breakpoint
+    uint8_t Count;                      // Number of breakpoints
+    float X_min;                        // Scheduling variable at the first breakpoint
+    float X_max;                        // Scheduling variable at the last breakpoint
+    float InvDx;                        // Inverse of the breakpoint spacing
+} pid_schedule_t;
+
+// PID gain schedule variables - Default values
+#define pid_schedule_t_default { \
+    .Table = {{0, 0, 0}}, \
+    .Count = 0, \
+    .X_min = 0, \
+    .X_max = 0, \
+    .InvDx = 0, \
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+class PidSchedule
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        // Schedule data
+        pid_schedule_t _Data = pid_schedule_t_default;
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        PidSchedule
+        // Description: Constructor of the class with no arguments
+        // Arguments:   None
+        // Returns:     None
+        PidSchedule();
+
+        // Name:        PidSchedule
+        // Description: Constructor of the class with the gain table and scheduling range
+        // Arguments:   Table - Gains at each breakpoint
+        //              Count - Number of breakpoints (2 to MAX_PID_SCHEDULE_POINTS)
+        //              X_min - Scheduling variable at the first breakpoint
+        //              X_max - Scheduling variable at the last breakpoint
+        // Returns:     None
+        PidSchedule(const pid_gains_t *Table, uint8_t Count, float X_min, float X_max);
+
+        // Name:        Init
+        // Description: Sets the gain table and scheduling range
+        // Arguments:   Table - Gains at each breakpoint
+        //              Count - Number of breakpoints (2 to MAX_PID_SCHEDULE_POINTS)
+        //              X_min - Scheduling variable at the first breakpoint
+        //              X_max - Scheduling variable at the last breakpoint (must be greater than X_min)
+        // Returns:     True if the table was accepted, false otherwise
+        bool Init(const pid_gains_t *Table, uint8_t Count, float X_min, float X_max);
+
+        // Name:        SetPoint
+        // Description: Sets the gains at one breakpoint
+        // Arguments:   Idx - Index of the breakpoint
+        //              Gains - The gains
+        // Returns:     None
+        void SetPoint(uint8_t Idx, const pid_gains_t *Gains);
+
+        // Name:        Lookup
+        // Description: Interpolates the gains for a value of the scheduling variable
+        // Arguments:   X - Scheduling variable
+        //              Gains - pid_gains_t struct to receive the gains
+        // Returns:     None
+        void Lookup(float X, pid_gains_t *Gains);
+
+        // Name:        Update
+        // Description: Interpolates the gains and applies them to a controller
+        // Arguments:   Controller - Controller to be updated
+        //              X - Scheduling variable
+        // Returns:     None
+        void Update(Pid *Controller, float X);
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
@@ -0,0 +1,293 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Templated PID controller library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      PidT<T> implements the Pid control law (derivative on measurement and integral freeze on
+//      saturation) for any number type supported by Num<T> (float, q15_t or q31_t, see Fixed_TivaC.hpp).
+
+//      The integral portion is accumulated directly (Ui += Ki * E), as in Pid, so the integrator state
+//      stays inside the fixed-point range for any Ki. With float numbers the output matches Pid in
+//      positional mode with the default setpoint weights bit for bit.
+
+//      Differences from the float Pid class:
+//          - Gains share one power of two scale (see SetScale). Gains set with SetGainsFloat are
+//            converted once, outside the sample path.
+//          - Only the core control law: no incremental mode, setpoint weights or ramp, feed-forward,
+//            integral hold, autotune or preset. Pid keeps these float-only features and its pid_t
+//            struct, so it is not an instantiation of PidT<float>.
+
+//      Usage example (Q15, gains up to 8.0):
+//          PidT<q15_t> Loop;
+//          Loop.SetScale(3);
+//          Loop.SetGainsFloat(2.5f, 0.01f, 0.2f);
+//          q15_t U = Loop.Compute(Y);
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef PIDT_TIVAC_H_
+#define PIDT_TIVAC_H_
+
+// Templates must have C++ linkage
+#ifdef __cplusplus
+extern "C++"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// Number traits
+#include "Fixed_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+class PidT
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        typedef typename Num<T>::Acc Acc;
+
+        T _Ref = 0;                 // Setpoint
+        T _E_now = 0;               // Error (sample k)
+        T _Y_lst = 0;               // Output (sample k - 1) -> Derivative on measurement
+        Acc _Ui_nxt = 0;            // Control action - Integral portion (sample k + 1)
+        T _Ut_nxt = 0;              // Control action - Total (sample k + 1)
+        bool _Saturated = false;    // Saturation flag
+        T _Kp = 0;                  // Proportional gain
+        T _Ki = 0;                  // Integral gain
+        T _Kd = 0;                  // Derivative gain
+        uint8_t _Scale = 0;         // Gain scale (power of two)
+        T _Ut_min = 0;              // Minimum output value
+        T _Ut_max = 0;              // Maximum output value
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        SetScale
+        // Description: Sets the power of two scale shared by all gains
+        // Arguments:   Scale - Gain scale (gain real value = gain * 2^Scale, limited to Num<T>::ScaleMax)
+        // Returns:     None
+        void SetScale(uint8_t Scale);
+
+        // Name:        SetGains
+        // Description: Sets the controller gains (already scaled)
+        // Arguments:   Kp - Proportional gain
+        //              Ki - Integral gain
+        //              Kd - Derivative gain
+        // Returns:     None
+        void SetGains(const T Kp, const T Ki, const T Kd);
+
+        // Name:        SetGainsFloat
+        // Description: Sets the controller gains from real values using the current scale
+        // Arguments:   Kp - Proportional gain
+        //              Ki - Integral gain
+        //              Kd - Derivative gain
+        // Returns:     None
+        void SetGainsFloat(const float Kp, const float Ki, const float Kd);
+
+        // Name:        GetGains
+        // Description: Gets the controller gains (scaled)
+        // Arguments:   Buffer - Buffer to receive the values
+        // Returns:     None
+        void GetGains(T *Buffer);
+
+        // Name:        SetReference
+        // Description: Sets the reference
+        // Arguments:   NewReference - The reference value
+        // Returns:     None
+        void SetReference(T NewReference);
+
+        // Name:        GetReference
+        // Description: Gets the reference
+        // Arguments:   None
+        // Returns:     The reference value
+        T GetReference();
+
+        // Name:        SetLimits
+        // Description: Sets the controller output limits
+        // Arguments:   Ut_min - Minimum output value
+        //              Ut_max - Maximum output value
+        // Returns:     None
+        void SetLimits(const T Ut_min, const T Ut_max);
+
+        // Name:        GetLimits
+        // Description: Gets the controller output limits
+        // Arguments:   Buffer - Buffer to receive the values
+        // Returns:     None
+        void GetLimits(T *Buffer);
+
+        // Name:        Compute
+        // Description: Computes the control action
+        // Arguments:   Y - Current system output
+        // Returns:     The new control action
+        T Compute(T Y);
+
+        // Name:        Reset
+        // Description: Resets the controller state (gains, reference and limits are kept)
+        // Arguments:   None
+        // Returns:     None
+        void Reset();
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void PidT<T>::SetScale(uint8_t Scale)
+{
+    if (Scale > Num<T>::ScaleMax)
+        Scale = Num<T>::ScaleMax;
+
+    _Scale = Scale;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void PidT<T>::SetGains(const T Kp, const T Ki, const T Kd)
+{
+    _Kp = Kp;
+    _Ki = Ki;
+    _Kd = Kd;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void PidT<T>::SetGainsFloat(const float Kp, const float Ki, const float Kd)
+{
+    SetGains(Num<T>::FromFloat(Kp, _Scale), Num<T>::FromFloat(Ki, _Scale), Num<T>::FromFloat(Kd, _Scale));
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void PidT<T>::GetGains(T *Buffer)
+{
+    Buffer[0] = _Kp;
+    Buffer[1] = _Ki;
+    Buffer[2] = _Kd;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void PidT<T>::SetReference(T NewReference)
+{
+    _Ref = NewReference;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+T PidT<T>::GetReference()
+{
+    return _Ref;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void PidT<T>::SetLimits(const T Ut_min, const T Ut_max)
+{
+    _Ut_min = Ut_min;
+    _Ut_max = Ut_max;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void PidT<T>::GetLimits(T *Buffer)
+{
+    Buffer[0] = _Ut_min;
+    Buffer[1] = _Ut_max;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+T PidT<T>::Compute(T Y)
+{
+    // Error - Sample k
+    _E_now = Num<T>::Sub(_Ref, Y);
+
+    // Integral portion - Anti windup
+    if (_Saturated == false)
+        _Ui_nxt = Num<T>::Add(_Ui_nxt, Num<T>::Mul(_Ki, _E_now, _Scale));
+
+    // Derivative error - Derivative on measurement
+    T E_der = Num<T>::Sub(_Y_lst, Y);
+
+    // Rotate buffer
+    _Y_lst = Y;
+
+    // Total control action - Sample k + 1
+    Acc Ut_nxt = Num<T>::Add(Num<T>::Add(Num<T>::Mul(_Kp, _E_now, _Scale), _Ui_nxt), Num<T>::Mul(_Kd, E_der, _Scale));
+
+    // Limiter - Maximum output exceeded
+    if (Ut_nxt >= (Acc)_Ut_max)
+    {
+        _Ut_nxt = _Ut_max;
+        _Saturated = true;
+    }
+
+    // Limiter - Minimum output exceeded
+    else if (Ut_nxt <= (Acc)_Ut_min)
+    {
+        _Ut_nxt = _Ut_min;
+        _Saturated = true;
+    }
+
+    // Limiter - Between limits
+    else
+    {
+        _Ut_nxt = Num<T>::Sat(Ut_nxt);
+        _Saturated = false;
+    }
+
+    // Return calculated value
+    return _Ut_nxt;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+void PidT<T>::Reset()
+{
+    _E_now = 0;
+    _Y_lst = 0;
+    _Ui_nxt = 0;
+    _Ut_nxt = 0;
+    _Saturated = false;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
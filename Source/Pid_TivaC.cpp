@@ -18,10 +18,288 @@
 // Standard libraries
 #include <stdint.h>
 
+// Execution time measurement
+#include "Wcet_TivaC.hpp"
+
+// Auxiliary functions
+#include <Aux_Functions.hpp>
+
 // ------------------------------------------------------------------------------------------------------- //
 // Functions definitions
 // ------------------------------------------------------------------------------------------------------- //
 
+// Name:        _UpdateCoefficients
+// Description: Folds the gains and sample time into the incremental form coefficients
+// Arguments:   None
+// Returns:     None
+
+void Pid::_UpdateCoefficients()
+{
+    // Proportional and integral coefficients
+    _Data.Cp = _Data.Kp;
+    _Data.Ci = _Data.Ki * _Data.Ts;
+
+    // Derivative coefficients - Backward Euler discretization of Kd*s / (Tf*s + 1)
+    _Data.Cd = _Data.Kd * _Data.InvTfTs;
+    _Data.Cf = _Data.Tf * _Data.InvTfTs;
+
+    // Back-calculation coefficient - Limited to one sample of tracking
+    _Data.Cb = _Data.Kb * _Data.Ts;
+
+    if ((_Data.Cb <= 0) || (_Data.Cb > 1))
+        _Data.Cb = 1;
+
+    // Default path coefficients - Proportional and integral portions on the error history
+    _Data.Q0 = _Data.Kp + _Data.Ci;
+    _Data.Q1 = -_Data.Kp;
+
+    // Default path - No setpoint weights, no derivative filter, output tracked in one sample
+    _Data.Fast = (_Data.Wb == 1) && (_Data.Wc == 0) && (_Data.Cf == 0) && (_Data.Cb == 1);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _ComputeIncremental
+// Description: Computes the control action using the incremental (velocity) form
+//              Default path: dU = Q0 * E(k) + Q1 * E(k - 1) + Cd * (Y(k - 1) - Y(k)) - Ud(k - 1),
+//              3 MACs plus the limiter. Setpoint weights, derivative filter, partial
+//              back-calculation or hold use the extended path
+// Arguments:   Y - Current system output
+//              FF - Feed-forward value
+// Returns:     The new control action
+
+float Pid::_ComputeIncremental(float Y, float FF)
+{
+    // Error - Sample k
+    _Data.E_now = _Data.Ref - Y;
+
+    // Default path - Three coefficients, the output is tracked in one sample
+    if ((_Data.Fast == true) && (_Data.Hold == false))
+    {
+        // Derivative portion - Derivative on measurement, not filtered
+        _Data.Ud_nxt = _Data.Cd * (_Data.Y_lst - Y);
+
+#if TELEMETRY_ENABLE
+        // Portions - Only needed by the telemetry record
+        _Data.Up_nxt = _Data.Cp * (_Data.E_now - _Data.E_lst);
+        _Data.Ui_nxt = _Data.Ci * _Data.E_now;
+#endif
+
+        // Feedback control action - Sample k + 1 - Continues from the limited output (without feed-forward)
+        _Data.Ut_lst = (_Data.Ut_nxt - _Data.FF) + _Data.Q0 * _Data.E_now + _Data.Q1 * _Data.E_lst +
+                       (_Data.Ud_nxt - _Data.Ud_lst);
+
+        // Rotate buffers
+        _Data.Y_lst = Y;
+        _Data.Ref_lst = _Data.Ref;
+        _Data.E_lst = _Data.E_now;
+    }
+
+    // Extended path - Weights, derivative filter, back-calculation and hold
+    else
+    {
+        // Proportional error - Weighted setpoint
+        float E_prp = _Data.Wb * _Data.Ref - Y;
+
+        // Derivative error - Weighted setpoint change and derivative on measurement
+        _Data.E_der = _Data.Wc * (_Data.Ref - _Data.Ref_lst) + (_Data.Y_lst - Y);
+
+        // Rotate buffers
+        _Data.Y_lst = Y;
+        _Data.Ref_lst = _Data.Ref;
+
+        // Proportional portion - Increment
+        _Data.Up_nxt = _Data.Cp * (E_prp - _Data.E_lst);
+
+        // Integral portion - Increment (none while held)
+        _Data.Ui_nxt = (_Data.Hold == false) ? _Data.Ci * _Data.E_now : 0;
+
+        // Derivative portion - Filtered
+        _Data.Ud_nxt = _Data.Cf * _Data.Ud_lst + _Data.Cd * _Data.E_der;
+
+        // Back-calculation anti windup - Pull the internal output towards the limited output (without feed-forward)
+        _Data.Ut_lst += _Data.Cb * ((_Data.Ut_nxt - _Data.FF) - _Data.Ut_lst);
+
+        // Feedback control action - Sample k + 1
+        _Data.Ut_lst += _Data.Up_nxt + _Data.Ui_nxt + (_Data.Ud_nxt - _Data.Ud_lst);
+
+        // Rotate buffers
+        _Data.E_lst = E_prp;
+    }
+
+    // Rotate buffers
+    _Data.Ud_lst = _Data.Ud_nxt;
+    _Data.FF = FF;
+
+    // Total control action - Sample k + 1
+    float Ut_tot = _Data.Ut_lst + FF;
+
+    // Limiter - Maximum output exceeded
+    if (Ut_tot >= _Data.Ut_max)
+    {
+        _Data.Ut_nxt = _Data.Ut_max;
+        _Data.Saturated = true;
+    }
+
+    // Limiter - Minimum output exceeded
+    else if (Ut_tot <= _Data.Ut_min)
+    {
+        _Data.Ut_nxt = _Data.Ut_min;
+        _Data.Saturated = true;
+    }
+
+    // Limiter - Between limits
+    else
+    {
+        _Data.Ut_nxt = Ut_tot;
+        _Data.Saturated = false;
+    }
+
+    // Telemetry tap
+    TELEMETRY_PUSH(TELEMETRY_PID, _TelemetryChannel, _TelemetryId, _Data.Saturated, _Data.E_now,
+                   _Data.Up_nxt, _Data.Ui_nxt, _Data.Ud_nxt, _Data.Ut_nxt);
+
+    // Return calculated value
+    return _Data.Ut_nxt;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _ComputeAutotune
+// Description: Runs one sample of the relay experiment
+// Arguments:   Y - Current system output
+// Returns:     The relay output
+
+float Pid::_ComputeAutotune(float Y)
+{
+    // Error - Sample k
+    _Data.E_now = _Data.Ref - Y;
+
+    // Rotate buffer
+    _Data.Y_lst = Y;
+
+    // Sample counter
+    _Tune.Samples++;
+
+    // Peak detection
+    if (Y > _Tune.Y_max)
+        _Tune.Y_max = Y;
+
+    if (Y < _Tune.Y_min)
+        _Tune.Y_min = Y;
+
+    // Relay - Switch to high (start of a new oscillation cycle)
+    if ((_Tune.RelayHigh == false) && (_Data.E_now > _Tune.Hysteresis))
+    {
+        _Tune.RelayHigh = true;
+
+        // Full cycle since the last switch - The first one is a transient and is discarded
+        if (_Tune.Switches >= 2)
+        {
+            _Tune.PeriodSum += _Tune.Samples - _Tune.LastSwitch;
+            _Tune.AmpSum += (_Tune.Y_max - _Tune.Y_min) * 0.5f;
+        }
+
+        _Tune.Switches++;
+        _Tune.LastSwitch = _Tune.Samples;
+        _Tune.Y_max = Y;
+        _Tune.Y_min = Y;
+
+        // Enough cycles measured
+        if (_Tune.Switches >= (_Tune.Cycles + 2))
+            _FinishAutotune();
+    }
+
+    // Relay - Switch to low
+    else if ((_Tune.RelayHigh == true) && (_Data.E_now < -_Tune.Hysteresis))
+        _Tune.RelayHigh = false;
+
+    // Timeout
+    if ((_Tune.State == PID_TUNE_RUNNING) && (_Tune.Samples >= _Tune.MaxSamples))
+        _Tune.State = PID_TUNE_FAILED;
+
+    // Relay output
+    _Data.Ut_nxt = _Tune.Bias + (_Tune.RelayHigh ? _Tune.Amplitude : -_Tune.Amplitude);
+
+    // Limiter
+    if (_Data.Ut_nxt >= _Data.Ut_max)
+        _Data.Ut_nxt = _Data.Ut_max;
+
+    else if (_Data.Ut_nxt <= _Data.Ut_min)
+        _Data.Ut_nxt = _Data.Ut_min;
+
+    // Return calculated value
+    return _Data.Ut_nxt;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _FinishAutotune
+// Description: Computes the ultimate gain and period and writes the tuned gains
+// Arguments:   None
+// Returns:     None
+
+void Pid::_FinishAutotune()
+{
+    // Average period (samples) and amplitude
+    float Pu = (float)_Tune.PeriodSum / _Tune.Cycles;
+    float A = _Tune.AmpSum / _Tune.Cycles;
+
+    // No oscillation above the hysteresis band
+    if (A <= _Tune.Hysteresis)
+    {
+        _Tune.State = PID_TUNE_FAILED;
+        return;
+    }
+
+    // Ultimate gain - Describing function of a relay with hysteresis
+    _Tune.Ku = (4.0f * _Tune.Amplitude) / (3.14159265f * Aux::Sqrt(A * A - _Tune.Hysteresis * _Tune.Hysteresis));
+    _Tune.Pu = Pu;
+
+    // Tuning rule - Integral and derivative times in samples
+    float Kp, Ti, Td;
+
+    if (_Tune.Rule == PID_TUNE_TYREUS_LUYBEN)
+    {
+        Kp = _Tune.Ku / 2.2f;
+        Ti = 2.2f * Pu;
+        Td = Pu / 6.3f;
+    }
+    else
+    {
+        Kp = 0.6f * _Tune.Ku;
+        Ti = 0.5f * Pu;
+        Td = 0.125f * Pu;
+    }
+
+    // Incremental mode uses continuous gains - Mode or sample time may have changed during the experiment
+    if (_Data.Mode == PID_MODE_INCREMENTAL)
+    {
+        if (!(_Data.Ts > 0))
+        {
+            _Tune.State = PID_TUNE_FAILED;
+            return;
+        }
+
+        Ti *= _Data.Ts;
+        Td *= _Data.Ts;
+    }
+
+    SetGains(Kp, Kp / Ti, Kp * Td);
+
+    // Resume from the relay bias
+    _Data.Saturated = false;
+    _Data.Ui_int = (_Data.Ki != 0) ? _Tune.Bias : 0;
+    _Data.E_lst = _Data.Wb * _Data.Ref - _Data.Y_lst;
+    _Data.Ud_lst = 0;
+    _Data.Ut_lst = _Tune.Bias;
+    _Data.FF = 0;
+
+    _Tune.State = PID_TUNE_DONE;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
 // Name:        Pid
 // Description: Constructor of the class with no arguments
 // Arguments:   None
@@ -54,6 +332,8 @@ Pid::Pid(const float Kp, const float Ki, const float Kd, const float Ref, const
 
 // Name:        SetGains
 // Description: Sets the controller gains
+//              Positional mode: discrete gains (Ki per sample, Kd per sample)
+//              Incremental mode: continuous gains (Ki in 1/s, Kd in s)
 // Arguments:   Kp - Proportional gain
 //              Ki - Integral gain
 //              Kd - Derivative gain
@@ -64,6 +344,9 @@ void Pid::SetGains(const float Kp, const float Ki, const float Kd)
     _Data.Kp = Kp;
     _Data.Ki = Ki;
     _Data.Kd = Kd;
+
+    // Incremental form coefficients
+    _UpdateCoefficients();
 }
 
 // ------------------------------------------------------------------------------------------------------- //
@@ -84,12 +367,17 @@ void Pid::GetGains(float *Buffer)
 
 // Name:        SetReference
 // Description: Sets the reference
+//              With a ramp set (SetRamp), the reference moves towards the new value one step per sample
 // Arguments:   NewReference - The reference value
 // Returns:     None
 
 void Pid::SetReference(float NewReference)
 {
-    _Data.Ref = NewReference;
+    _Data.RefTarget = NewReference;
+
+    // No ramp - Step
+    if (_Data.RampStep <= 0)
+        _Data.Ref = NewReference;
 }
 
 // ------------------------------------------------------------------------------------------------------- //
@@ -97,11 +385,45 @@ void Pid::SetReference(float NewReference)
 // Name:        GetReference
 // Description: Gets the reference 
 // Arguments:   None
-// Returns:     The reference value
+// Returns:     The reference value (target of the ramp)
 
 float Pid::GetReference()
 {
-    return _Data.Ref;
+    return _Data.RefTarget;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetRamp
+// Description: Sets the setpoint rate limiter
+// Arguments:   Step - Maximum reference change per sample (0 to apply references as steps)
+// Returns:     None
+
+void Pid::SetRamp(const float Step)
+{
+    _Data.RampStep = Step;
+
+    // Ramp disabled - Finish the current ramp
+    if (Step <= 0)
+        _Data.Ref = _Data.RefTarget;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetWeights
+// Description: Sets the setpoint weights of the proportional and derivative portions
+//              Up = Kp * (b * Ref - Y), Ud = Kd * (c * dRef - dY), the integral portion always uses Ref - Y
+// Arguments:   b - Proportional setpoint weight (default 1)
+//              c - Derivative setpoint weight (default 0, derivative on measurement)
+// Returns:     None
+
+void Pid::SetWeights(const float b, const float c)
+{
+    _Data.Wb = b;
+    _Data.Wc = c;
+
+    // Incremental form coefficients - Default path only without weights
+    _UpdateCoefficients();
 }
 
 // ------------------------------------------------------------------------------------------------------- //
@@ -133,6 +455,193 @@ void Pid::GetLimits(float *Buffer)
 
 // ------------------------------------------------------------------------------------------------------- //
 
+// Name:        SetMode
+// Description: Sets the computation mode
+//              The incremental form state is loaded from the last output, so the change is bumpless
+// Arguments:   NewMode - PID_MODE_POSITIONAL or PID_MODE_INCREMENTAL
+// Returns:     None
+
+void Pid::SetMode(pid_mode_t NewMode)
+{
+    if ((NewMode == PID_MODE_INCREMENTAL) && (_Data.Mode != PID_MODE_INCREMENTAL))
+    {
+        _Data.E_lst = _Data.Wb * _Data.Ref - _Data.Y_lst;
+        _Data.Ud_lst = 0;
+        _Data.Ut_lst = _Data.Ut_nxt - _Data.FF;
+    }
+
+    _Data.Mode = NewMode;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetMode
+// Description: Gets the computation mode
+// Arguments:   None
+// Returns:     The computation mode
+
+pid_mode_t Pid::GetMode()
+{
+    return _Data.Mode;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetSampleTime
+// Description: Sets the sample time used by the incremental mode
+// Arguments:   Ts - Sample time (s)
+// Returns:     None
+
+void Pid::SetSampleTime(const float Ts)
+{
+    _Data.Ts = Ts;
+    _Data.InvTfTs = ((_Data.Tf + _Data.Ts) > 0) ? 1.0f / (_Data.Tf + _Data.Ts) : 0;
+
+    // Incremental form coefficients
+    _UpdateCoefficients();
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetDerivativeFilter
+// Description: Sets the time constant of the first-order derivative filter (incremental mode)
+// Arguments:   Tf - Filter time constant (s), 0 to disable the filter
+// Returns:     None
+
+void Pid::SetDerivativeFilter(const float Tf)
+{
+    _Data.Tf = Tf;
+    _Data.InvTfTs = ((_Data.Tf + _Data.Ts) > 0) ? 1.0f / (_Data.Tf + _Data.Ts) : 0;
+
+    // Incremental form coefficients
+    _UpdateCoefficients();
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetBackCalculation
+// Description: Sets the back-calculation anti-windup gain (incremental mode)
+//              The integrator is driven towards the saturated output with rate Kb
+// Arguments:   Kb - Back-calculation gain (1/s), 0 to track the saturated output in one sample
+// Returns:     None
+
+void Pid::SetBackCalculation(const float Kb)
+{
+    _Data.Kb = Kb;
+
+    // Incremental form coefficients
+    _UpdateCoefficients();
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        StartAutotune
+// Description: Starts an Astrom-Hagglund relay experiment around the current reference
+//              Compute drives the relay one sample per call. When the experiment is done the
+//              tuned gains are written with SetGains (units of the current mode) and Compute
+//              resumes normal operation from the relay bias
+// Arguments:   Bias - Relay output center
+//              Amplitude - Relay amplitude
+//              Hysteresis - Relay hysteresis (error units, larger than the measurement noise)
+//              Rule - Tuning rule
+//              Cycles - Number of oscillation cycles to average (the first cycle is discarded,
+//                       1 to PID_TUNE_MAX_CYCLES)
+//              MaxSamples - Sample limit before the experiment fails
+// Returns:     None - The state is PID_TUNE_FAILED at once in incremental mode with no sample time
+
+void Pid::StartAutotune(float Bias, float Amplitude, float Hysteresis, pid_tune_rule_t Rule, uint8_t Cycles, uint32_t MaxSamples)
+{
+    _Tune = pid_tune_t_default;
+
+    _Tune.Rule = Rule;
+    _Tune.Bias = Bias;
+    _Tune.Amplitude = Amplitude;
+    _Tune.Hysteresis = Hysteresis;
+    _Tune.Cycles = (Cycles == 0) ? 1 : (Cycles > PID_TUNE_MAX_CYCLES) ? PID_TUNE_MAX_CYCLES : Cycles;
+    _Tune.MaxSamples = MaxSamples;
+
+    // Incremental mode gains are scaled by Ts - Not possible before SetSampleTime
+    _Tune.State = ((_Data.Mode == PID_MODE_INCREMENTAL) && !(_Data.Ts > 0)) ? PID_TUNE_FAILED : PID_TUNE_RUNNING;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        StopAutotune
+// Description: Aborts the relay experiment (gains are not changed)
+// Arguments:   None
+// Returns:     None
+
+void Pid::StopAutotune()
+{
+    if (_Tune.State == PID_TUNE_RUNNING)
+        _Tune.State = PID_TUNE_OFF;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetAutotuneState
+// Description: Gets the autotune state
+// Arguments:   None
+// Returns:     The autotune state
+
+pid_tune_state_t Pid::GetAutotuneState()
+{
+    return _Tune.State;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetAutotuneResult
+// Description: Gets the ultimate gain and period found by the last experiment
+// Arguments:   Buffer - Buffer to receive the values (Ku, Pu in samples)
+// Returns:     None
+
+void Pid::GetAutotuneResult(float *Buffer)
+{
+    Buffer[0] = _Tune.Ku;
+    Buffer[1] = _Tune.Pu;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetHold
+// Description: Freezes or releases the integral portion (e.g. while an inner loop is saturated)
+// Arguments:   Hold - True to freeze the integral portion
+// Returns:     None
+
+void Pid::SetHold(bool Hold)
+{
+    _Data.Hold = Hold;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetSaturated
+// Description: Gets the saturation flag of the last sample
+// Arguments:   None
+// Returns:     True if the output was limited in the last sample
+
+bool Pid::GetSaturated()
+{
+    return _Data.Saturated;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetTelemetryId
+// Description: Sets the id written in the telemetry records of this controller and its ring
+// Arguments:   Id - Controller id
+//              Channel - Telemetry ring (0 to TELEMETRY_CHANNELS - 1, one per ISR priority)
+// Returns:     None
+
+void Pid::SetTelemetryId(uint8_t Id, uint8_t Channel)
+{
+    _TelemetryId = Id;
+    _TelemetryChannel = (Channel < TELEMETRY_CHANNELS) ? Channel : (TELEMETRY_CHANNELS - 1);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
 // Name:        Compute
 // Description: Computes the control action
 // Arguments:   Y - Current system output
@@ -140,30 +649,71 @@ void Pid::GetLimits(float *Buffer)
 
 float Pid::Compute(float Y)
 {
+    return Compute(Y, 0);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Compute
+// Description: Computes the control action with a feed-forward input
+// Arguments:   Y - Current system output
+//              FF - Feed-forward value, added to the control action before the limiter
+// Returns:     The new control action
+
+float Pid::Compute(float Y, float FF)
+{
+    // Execution time measurement
+    WCET_SCOPE(WCET_PID);
+
+    // Relay experiment
+    if (_Tune.State == PID_TUNE_RUNNING)
+        return _ComputeAutotune(Y);
+
+    // Setpoint ramp - Reference moves at most RampStep per sample
+    if (_Data.Ref != _Data.RefTarget)
+    {
+        float Delta = _Data.RefTarget - _Data.Ref;
+
+        if (Delta > _Data.RampStep)
+            _Data.Ref += _Data.RampStep;
+
+        else if (Delta < -_Data.RampStep)
+            _Data.Ref -= _Data.RampStep;
+
+        else
+            _Data.Ref = _Data.RefTarget;
+    }
+
+    // Incremental form
+    if (_Data.Mode == PID_MODE_INCREMENTAL)
+        return _ComputeIncremental(Y, FF);
+
     // Error - Sample k
     _Data.E_now = _Data.Ref - Y;
 
-    // Integral error - Anti windup
-    if (_Data.Saturated == false)
-        _Data.E_int += _Data.E_now;
+    // Integral portion - Anti windup and hold - Accumulated with the gain of each sample
+    if ((_Data.Saturated == false) && (_Data.Hold == false))
+        _Data.Ui_int += _Data.Ki * _Data.E_now;
 
-    // Derivative error - Derivative on measurement
-    _Data.E_der = _Data.Y_lst - Y;
+    // Derivative error - Weighted setpoint change and derivative on measurement
+    _Data.E_der = _Data.Wc * (_Data.Ref - _Data.Ref_lst) + (_Data.Y_lst - Y);
 
-    // Rotate buffer
+    // Rotate buffers
     _Data.Y_lst = Y;
+    _Data.Ref_lst = _Data.Ref;
 
-    // Proportional portion - Sample k + 1
-    _Data.Up_nxt = _Data.E_now * _Data.Kp;
+    // Proportional portion - Sample k + 1 - Weighted setpoint
+    _Data.Up_nxt = (_Data.Wb * _Data.Ref - Y) * _Data.Kp;
 
     // Integral portion - Sample k + 1
-    _Data.Ui_nxt = _Data.E_int * _Data.Ki;
+    _Data.Ui_nxt = _Data.Ui_int;
 
     // Derivative portion - Sample k + 1
     _Data.Ud_nxt = _Data.E_der * _Data.Kd;
 
     // Total control action - Sample k + 1
-    _Data.Ut_nxt = (_Data.Up_nxt + _Data.Ui_nxt + _Data.Ud_nxt);
+    _Data.Ut_nxt = (_Data.Up_nxt + _Data.Ui_nxt + _Data.Ud_nxt) + FF;
+    _Data.FF = FF;
 
     // Limiter - Maximum output exceeded
     if (_Data.Ut_nxt >= _Data.Ut_max)
@@ -183,6 +733,10 @@ float Pid::Compute(float Y)
     else
         _Data.Saturated = false;  
 
+    // Telemetry tap
+    TELEMETRY_PUSH(TELEMETRY_PID, _TelemetryChannel, _TelemetryId, _Data.Saturated, _Data.E_now,
+                   _Data.Up_nxt, _Data.Ui_nxt, _Data.Ud_nxt, _Data.Ut_nxt);
+
     // Return calculated value
     return _Data.Ut_nxt;  
 }
@@ -200,3 +754,37 @@ void Pid::Reset()
 }
 
 // ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Preset
+// Description: Loads the internal state so the next Compute continues from Ut (bumpless transfer)
+// Arguments:   Ut - Control action to continue from
+//              Y - Current measurement
+// Returns:     None
+
+void Pid::Preset(float Ut, float Y)
+{
+    // Measurement and setpoint history - No derivative kick on the next sample
+    _Data.Y_lst = Y;
+    _Data.Ref_lst = _Data.Ref;
+    _Data.E_now = _Data.Ref - Y;
+
+    // Feedback portion of the output
+    float Ut_fb = Ut - _Data.FF;
+
+    // Incremental form - The internal output continues from Ut
+    if (_Data.Mode == PID_MODE_INCREMENTAL)
+    {
+        _Data.Ut_lst = Ut_fb;
+        _Data.E_lst = _Data.Wb * _Data.Ref - Y;
+        _Data.Ud_lst = 0;
+    }
+
+    // Positional form - The integral portion absorbs the difference
+    else if (_Data.Ki != 0)
+        _Data.Ui_int = Ut_fb - _Data.Kp * (_Data.Wb * _Data.Ref - Y) - _Data.Ki * _Data.E_now;
+
+    _Data.Ut_nxt = Ut;
+    _Data.Saturated = false;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
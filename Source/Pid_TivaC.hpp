@@ -23,10 +23,42 @@ extern "C"
 // Standard libraries
 #include <stdint.h>
 
+// Controller telemetry
+#include "Telemetry_TivaC.hpp"
+
 // ------------------------------------------------------------------------------------------------------- //
 // Definitions
 // ------------------------------------------------------------------------------------------------------- //
 
+#define PID_TUNE_MAX_CYCLES 253     // Maximum autotune cycles (Cycles + 2 switches must fit in uint8_t)
+
+// ------------------------------------------------------------------------------------------------------- //
+// Program enumerations
+// ------------------------------------------------------------------------------------------------------- //
+
+// PID computation modes
+typedef enum
+{
+    PID_MODE_POSITIONAL,            // Positional form (discrete gains, integral freeze on saturation)
+    PID_MODE_INCREMENTAL,           // Incremental (velocity) form (continuous gains, back-calculation)
+} pid_mode_t;
+
+// Autotune tuning rules
+typedef enum
+{
+    PID_TUNE_ZIEGLER_NICHOLS,       // Ziegler-Nichols (Kp = 0.6 Ku, Ti = Pu / 2, Td = Pu / 8)
+    PID_TUNE_TYREUS_LUYBEN,         // Tyreus-Luyben (Kp = Ku / 2.2, Ti = 2.2 Pu, Td = Pu / 6.3)
+} pid_tune_rule_t;
+
+// Autotune states
+typedef enum
+{
+    PID_TUNE_OFF,                   // Autotune not started
+    PID_TUNE_RUNNING,               // Relay experiment running
+    PID_TUNE_DONE,                  // Gains written to the controller
+    PID_TUNE_FAILED,                // Timeout or no oscillation detected
+} pid_tune_state_t;
+
 // ------------------------------------------------------------------------------------------------------- //
 // Structs
 // ------------------------------------------------------------------------------------------------------- //
@@ -37,18 +69,41 @@ typedef struct
     float Ref;                  // Setpoint
     float E_now;                // Error (sample k)
     float Y_lst;                // Output (sample k - 1) -> Derivative on measurement
-    float E_int;                // Error (integral)
+    float Ui_int;               // Control action - Integral portion, accumulated (sum of Ki * E)
     float E_der;                // Error (derivative) -> Derivative on measurement
     float Up_nxt;               // Control action - Proportional portion (sample k + 1)
     float Ui_nxt;               // Control action - Integral portion (sample k + 1)
     float Ud_nxt;               // Control action - Derivative portion (sample k + 1)
     float Ut_nxt;               // Control action - Total (sample k + 1)
     bool Saturated;             // Saturation flag
+    bool Hold;                  // Integral portion hold flag
     float Kp;                   // Proportional gain
     float Ki;                   // Integral gain
     float Kd;                   // Derivative gain
     float Ut_min;               // Minimum output value
     float Ut_max;               // Maximum output value
+    pid_mode_t Mode;            // Computation mode
+    float Ts;                   // Sample time (s) - Incremental mode
+    float Tf;                   // Derivative filter time constant (s) - Incremental mode
+    float Kb;                   // Back-calculation gain (1/s, 0 = track saturated output) - Incremental mode
+    float InvTfTs;              // 1 / (Tf + Ts) - Incremental mode
+    float Cp;                   // Coefficient - Proportional (Kp) - Incremental mode
+    float Ci;                   // Coefficient - Integral (Ki * Ts) - Incremental mode
+    float Cd;                   // Coefficient - Derivative (Kd / (Tf + Ts)) - Incremental mode
+    float Cf;                   // Coefficient - Derivative filter (Tf / (Tf + Ts)) - Incremental mode
+    float Cb;                   // Coefficient - Back-calculation (Kb * Ts) - Incremental mode
+    float Q0;                   // Coefficient - Error k (Kp + Ki * Ts) - Incremental mode, default path
+    float Q1;                   // Coefficient - Error k - 1 (-Kp) - Incremental mode, default path
+    bool Fast;                  // Default path (b = 1, c = 0, Tf = 0, Cb = 1) - Incremental mode
+    float E_lst;                // Error - Proportional portion, weighted (sample k - 1) - Incremental mode
+    float Ud_lst;               // Control action - Derivative portion (sample k) - Incremental mode
+    float Ut_lst;               // Control action - Total before the limiter (sample k) - Incremental mode
+    float RefTarget;            // Setpoint requested by SetReference (Ref ramps towards it)
+    float RampStep;             // Maximum setpoint change per sample (0 = step)
+    float Ref_lst;              // Setpoint (sample k - 1) -> Setpoint weight on the derivative portion
+    float Wb;                   // Setpoint weight - Proportional portion (b)
+    float Wc;                   // Setpoint weight - Derivative portion (c)
+    float FF;                   // Feed-forward input (sample k)
 } pid_t;
 
 // PID controller variables - Default values
@@ -56,18 +111,84 @@ typedef struct
     .Ref = 0, \
     .E_now = 0, \
     .Y_lst = 0, \
-    .E_int = 0, \
+    .Ui_int = 0, \
     .E_der = 0, \
-    .Ui_nxt = 0, \
     .Up_nxt = 0, \
+    .Ui_nxt = 0, \
     .Ud_nxt = 0, \
     .Ut_nxt = 0, \
     .Saturated = false, \
+    .Hold = false, \
     .Kp = 0, \
     .Ki = 0, \
     .Kd = 0, \
     .Ut_min = 0, \
     .Ut_max = 0, \
+    .Mode = PID_MODE_POSITIONAL, \
+    .Ts = 0, \
+    .Tf = 0, \
+    .Kb = 0, \
+    .InvTfTs = 0, \
+    .Cp = 0, \
+    .Ci = 0, \
+    .Cd = 0, \
+    .Cf = 0, \
+    .Cb = 1, \
+    .Q0 = 0, \
+    .Q1 = 0, \
+    .Fast = true, \
+    .E_lst = 0, \
+    .Ud_lst = 0, \
+    .Ut_lst = 0, \
+    .RefTarget = 0, \
+    .RampStep = 0, \
+    .Ref_lst = 0, \
+    .Wb = 1, \
+    .Wc = 0, \
+    .FF = 0, \
+}
+
+// PID autotune variables (relay experiment)
+typedef struct
+{
+    pid_tune_state_t State;     // Autotune state
+    pid_tune_rule_t Rule;       // Tuning rule
+    float Bias;                 // Relay output center
+    float Amplitude;            // Relay amplitude
+    float Hysteresis;           // Relay hysteresis (error units)
+    bool RelayHigh;             // Relay output state
+    uint8_t Cycles;             // Number of oscillation cycles to average
+    uint8_t Switches;           // Number of relay switches to high
+    uint32_t Samples;           // Sample counter
+    uint32_t MaxSamples;        // Sample limit (timeout)
+    uint32_t LastSwitch;        // Sample of the last relay switch to high
+    uint32_t PeriodSum;         // Sum of the measured periods (samples)
+    float AmpSum;               // Sum of the measured oscillation amplitudes
+    float Y_max;                // Maximum output in the current cycle
+    float Y_min;                // Minimum output in the current cycle
+    float Ku;                   // Ultimate gain
+    float Pu;                   // Ultimate period (samples)
+} pid_tune_t;
+
+// PID autotune variables - Default values
+#define pid_tune_t_default { \
+    .State = PID_TUNE_OFF, \
+    .Rule = PID_TUNE_ZIEGLER_NICHOLS, \
+    .Bias = 0, \
+    .Amplitude = 0, \
+    .Hysteresis = 0, \
+    .RelayHigh = false, \
+    .Cycles = 0, \
+    .Switches = 0, \
+    .Samples = 0, \
+    .MaxSamples = 0, \
+    .LastSwitch = 0, \
+    .PeriodSum = 0, \
+    .AmpSum = 0, \
+    .Y_max = 0, \
+    .Y_min = 0, \
+    .Ku = 0, \
+    .Pu = 0, \
 }
 
 // ------------------------------------------------------------------------------------------------------- //
@@ -85,6 +206,41 @@ class Pid
         // PID data
         pid_t _Data = pid_t_default;
 
+        // Autotune data
+        pid_tune_t _Tune = pid_tune_t_default;
+
+        // Telemetry id
+        uint8_t _TelemetryId = 0;
+        uint8_t _TelemetryChannel = 0;
+
+        // Name:        _UpdateCoefficients
+        // Description: Folds the gains and sample time into the incremental form coefficients
+        // Arguments:   None
+        // Returns:     None
+        void _UpdateCoefficients();
+
+        // Name:        _ComputeIncremental
+        // Description: Computes the control action using the incremental (velocity) form
+        //              Default path: dU = Q0 * E(k) + Q1 * E(k - 1) + Cd * (Y(k - 1) - Y(k)) - Ud(k - 1),
+        //              3 MACs plus the limiter. Setpoint weights, derivative filter, partial
+        //              back-calculation or hold use the extended path
+        // Arguments:   Y - Current system output
+        //              FF - Feed-forward value
+        // Returns:     The new control action
+        float _ComputeIncremental(float Y, float FF);
+
+        // Name:        _ComputeAutotune
+        // Description: Runs one sample of the relay experiment
+        // Arguments:   Y - Current system output
+        // Returns:     The relay output
+        float _ComputeAutotune(float Y);
+
+        // Name:        _FinishAutotune
+        // Description: Computes the ultimate gain and period and writes the tuned gains
+        // Arguments:   None
+        // Returns:     None
+        void _FinishAutotune();
+
     // --------------------------------------------------------------------------------------------------- //
     // Public members
     // --------------------------------------------------------------------------------------------------- //
@@ -110,6 +266,8 @@ class Pid
 
         // Name:        SetGains
         // Description: Sets the controller gains
+        //              Positional mode: discrete gains (Ki per sample, Kd per sample)
+        //              Incremental mode: continuous gains (Ki in 1/s, Kd in s)
         // Arguments:   Kp - Proportional gain
         //              Ki - Integral gain
         //              Kd - Derivative gain
@@ -124,6 +282,7 @@ class Pid
 
         // Name:        SetReference
         // Description: Sets the reference
+        //              With a ramp set (SetRamp), the reference moves towards the new value one step per sample
         // Arguments:   NewReference - The reference value
         // Returns:     None
         void SetReference(float NewReference);
@@ -131,9 +290,23 @@ class Pid
         // Name:        GetReference
         // Description: Gets the reference 
         // Arguments:   None
-        // Returns:     The reference value
+        // Returns:     The reference value (target of the ramp)
         float GetReference();
 
+        // Name:        SetRamp
+        // Description: Sets the setpoint rate limiter
+        // Arguments:   Step - Maximum reference change per sample (0 to apply references as steps)
+        // Returns:     None
+        void SetRamp(const float Step);
+
+        // Name:        SetWeights
+        // Description: Sets the setpoint weights of the proportional and derivative portions
+        //              Up = Kp * (b * Ref - Y), Ud = Kd * (c * dRef - dY), the integral portion always uses Ref - Y
+        // Arguments:   b - Proportional setpoint weight (default 1)
+        //              c - Derivative setpoint weight (default 0, derivative on measurement)
+        // Returns:     None
+        void SetWeights(const float b, const float c);
+
         // Name:        SetLimits
         // Description: Sets the controller output limits
         // Arguments:   Ut_min - Minimum output value
@@ -147,17 +320,115 @@ class Pid
         // Returns:     None
         void GetLimits(float *Buffer);
 
+        // Name:        SetMode
+        // Description: Sets the computation mode
+        //              The incremental form state is loaded from the last output, so the change is bumpless
+        // Arguments:   NewMode - PID_MODE_POSITIONAL or PID_MODE_INCREMENTAL
+        // Returns:     None
+        void SetMode(pid_mode_t NewMode);
+
+        // Name:        GetMode
+        // Description: Gets the computation mode
+        // Arguments:   None
+        // Returns:     The computation mode
+        pid_mode_t GetMode();
+
+        // Name:        SetSampleTime
+        // Description: Sets the sample time used by the incremental mode
+        // Arguments:   Ts - Sample time (s)
+        // Returns:     None
+        void SetSampleTime(const float Ts);
+
+        // Name:        SetDerivativeFilter
+        // Description: Sets the time constant of the first-order derivative filter (incremental mode)
+        // Arguments:   Tf - Filter time constant (s), 0 to disable the filter
+        // Returns:     None
+        void SetDerivativeFilter(const float Tf);
+
+        // Name:        SetBackCalculation
+        // Description: Sets the back-calculation anti-windup gain (incremental mode)
+        //              The integrator is driven towards the saturated output with rate Kb
+        // Arguments:   Kb - Back-calculation gain (1/s), 0 to track the saturated output in one sample
+        // Returns:     None
+        void SetBackCalculation(const float Kb);
+
+        // Name:        StartAutotune
+        // Description: Starts an Astrom-Hagglund relay experiment around the current reference
+        //              Compute drives the relay one sample per call. When the experiment is done the
+        //              tuned gains are written with SetGains (units of the current mode) and Compute
+        //              resumes normal operation from the relay bias
+        // Arguments:   Bias - Relay output center
+        //              Amplitude - Relay amplitude
+        //              Hysteresis - Relay hysteresis (error units, larger than the measurement noise)
+        //              Rule - Tuning rule
+        //              Cycles - Number of oscillation cycles to average (the first cycle is discarded,
+        //                       1 to PID_TUNE_MAX_CYCLES)
+        //              MaxSamples - Sample limit before the experiment fails
+        // Returns:     None - The state is PID_TUNE_FAILED at once in incremental mode with no sample time
+        void StartAutotune(float Bias, float Amplitude, float Hysteresis, pid_tune_rule_t Rule, uint8_t Cycles, uint32_t MaxSamples);
+
+        // Name:        StopAutotune
+        // Description: Aborts the relay experiment (gains are not changed)
+        // Arguments:   None
+        // Returns:     None
+        void StopAutotune();
+
+        // Name:        GetAutotuneState
+        // Description: Gets the autotune state
+        // Arguments:   None
+        // Returns:     The autotune state
+        pid_tune_state_t GetAutotuneState();
+
+        // Name:        GetAutotuneResult
+        // Description: Gets the ultimate gain and period found by the last experiment
+        // Arguments:   Buffer - Buffer to receive the values (Ku, Pu in samples)
+        // Returns:     None
+        void GetAutotuneResult(float *Buffer);
+
+        // Name:        SetHold
+        // Description: Freezes or releases the integral portion (e.g. while an inner loop is saturated)
+        // Arguments:   Hold - True to freeze the integral portion
+        // Returns:     None
+        void SetHold(bool Hold);
+
+        // Name:        GetSaturated
+        // Description: Gets the saturation flag of the last sample
+        // Arguments:   None
+        // Returns:     True if the output was limited in the last sample
+        bool GetSaturated();
+
+        // Name:        SetTelemetryId
+        // Description: Sets the id written in the telemetry records of this controller and its ring
+        // Arguments:   Id - Controller id
+        //              Channel - Telemetry ring (0 to TELEMETRY_CHANNELS - 1, one per ISR priority)
+        // Returns:     None
+        void SetTelemetryId(uint8_t Id, uint8_t Channel = 0);
+
         // Name:        Compute
         // Description: Computes the control action
         // Arguments:   Y - Current system output
         // Returns:     The new control action
         float Compute(float Y);
 
+        // Name:        Compute
+        // Description: Computes the control action with a feed-forward input
+        // Arguments:   Y - Current system output
+        //              FF - Feed-forward value, added to the control action before the limiter
+        // Returns:     The new control action
+        float Compute(float Y, float FF);
+
         // Name:        Reset
         // Description: Resets the controller to its initial state
         // Arguments:   None
         // Returns:     None
         void Reset();
+
+        // Name:        Preset
+        // Description: Loads the internal state so the next Compute continues from Ut (bumpless transfer)
+        // Arguments:   Ut - Control action to continue from
+        //              Y - Current measurement
+        // Returns:     None
+        void Preset(float Ut, float Y);
 };
 
 // ------------------------------------------------------------------------------------------------------- //
@@ -25,6 +25,9 @@
 // Standard libraries
 #include <stdint.h>
 
+// Execution time measurement
+#include "Wcet_TivaC.hpp"
+
 // Auxiliary functions
 #include <Aux_Functions.hpp>
 
@@ -151,6 +154,9 @@ void Rgb::_FadeService()
     static uint16_t _StepSkipG = 0;
     static uint16_t _StepSkipB = 0;
 
+    // Execution time measurement
+    WCET_SCOPE(WCET_RGB_FADE);
+
     // Make sure PWM frequency is right (may change if PWM clock is divided externally)
     _SetPwmFrequency(_Config.Params.PwmFrequency);
 
@@ -0,0 +1,255 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Single-producer single-consumer ring buffer library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      SpscRing<T, Size> is a wait-free ring buffer for one producer (usually an ISR) and one
+//      consumer (usually the main loop). Neither side ever blocks or disables interrupts:
+//          - The producer only writes _Head, the consumer only writes _Tail.
+//          - Indices run freely and are masked on access, so Size must be a power of two and all
+//            Size slots are usable.
+//          - A compiler barrier orders the slot access against the index update. This is enough
+//            on the single-core Cortex-M4; no hardware barrier is needed.
+
+//      When the ring is full, Push drops the new element and counts it (see GetDropped).
+
+//      The producer can build an element in place with Reserve / Commit to avoid a copy:
+//          telemetry_t *Slot = Ring.Reserve();
+//          if (Slot != nullptr) { Slot->Ut = Ut; Ring.Commit(); }
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef RING_TIVAC_H_
+#define RING_TIVAC_H_
+
+// Templates must have C++ linkage
+#ifdef __cplusplus
+extern "C++"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Compiler barrier - Keeps slot accesses on their side of the index update
+#if defined(__GNUC__) || defined(__clang__)
+#define RING_BARRIER() __asm volatile ("" ::: "memory")
+#elif defined(__TI_COMPILER_VERSION__)
+#define RING_BARRIER() __memory_changed()
+#else
+#error "Ring: no compiler barrier for this compiler"
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint32_t Size>
+class SpscRing
+{
+    static_assert((Size >= 2) && ((Size & (Size - 1)) == 0), "SpscRing size must be a power of two");
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        T _Buffer[Size];                // Elements
+        volatile uint32_t _Head = 0;    // Write index - Producer only
+        volatile uint32_t _Tail = 0;    // Read index - Consumer only
+        volatile uint32_t _Dropped = 0; // Elements dropped because the ring was full - Producer only
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        Reserve
+        // Description: Gets the next free slot (producer side)
+        // Arguments:   None
+        // Returns:     Pointer to the slot, nullptr if the ring is full (the drop is counted)
+        T *Reserve();
+
+        // Name:        Commit
+        // Description: Publishes the slot obtained with Reserve (producer side)
+        // Arguments:   None
+        // Returns:     None
+        void Commit();
+
+        // Name:        Push
+        // Description: Copies one element into the ring (producer side)
+        // Arguments:   Element - Element to be pushed
+        // Returns:     True if the element was pushed, false if the ring was full
+        bool Push(const T &Element);
+
+        // Name:        Pop
+        // Description: Removes one element from the ring (consumer side)
+        // Arguments:   Element - Variable to receive the element
+        // Returns:     True if an element was removed, false if the ring was empty
+        bool Pop(T *Element);
+
+        // Name:        Drain
+        // Description: Removes up to Max elements from the ring (consumer side)
+        // Arguments:   Buffer - Buffer to receive the elements
+        //              Max - Buffer size (elements)
+        // Returns:     Number of elements removed
+        uint32_t Drain(T *Buffer, uint32_t Max);
+
+        // Name:        GetCount
+        // Description: Gets the number of elements in the ring
+        // Arguments:   None
+        // Returns:     Number of elements
+        uint32_t GetCount();
+
+        // Name:        GetDropped
+        // Description: Gets the number of elements dropped because the ring was full
+        // Arguments:   None
+        // Returns:     Number of dropped elements
+        uint32_t GetDropped();
+
+        // Name:        Clear
+        // Description: Discards all elements (consumer side)
+        // Arguments:   None
+        // Returns:     None
+        void Clear();
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint32_t Size>
+inline T *SpscRing<T, Size>::Reserve()
+{
+    uint32_t Head = _Head;
+
+    // Full
+    if ((Head - _Tail) >= Size)
+    {
+        _Dropped = _Dropped + 1;
+        return nullptr;
+    }
+
+    return &_Buffer[Head & (Size - 1)];
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint32_t Size>
+inline void SpscRing<T, Size>::Commit()
+{
+    // Slot must be written before it is published
+    RING_BARRIER();
+    _Head = _Head + 1;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint32_t Size>
+inline bool SpscRing<T, Size>::Push(const T &Element)
+{
+    T *Slot = Reserve();
+
+    if (Slot == nullptr)
+        return false;
+
+    *Slot = Element;
+    Commit();
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint32_t Size>
+inline bool SpscRing<T, Size>::Pop(T *Element)
+{
+    uint32_t Tail = _Tail;
+
+    // Empty
+    if (Tail == _Head)
+        return false;
+
+    // Slot must be read after the index and before it is released
+    RING_BARRIER();
+    *Element = _Buffer[Tail & (Size - 1)];
+    RING_BARRIER();
+
+    _Tail = Tail + 1;
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint32_t Size>
+uint32_t SpscRing<T, Size>::Drain(T *Buffer, uint32_t Max)
+{
+    uint32_t Tail = _Tail;
+    uint32_t Count = _Head - Tail;
+
+    if (Count > Max)
+        Count = Max;
+
+    // Slots must be read after the index and before they are released
+    RING_BARRIER();
+
+    for (uint32_t Idx = 0; Idx < Count; Idx++)
+        Buffer[Idx] = _Buffer[(Tail + Idx) & (Size - 1)];
+
+    RING_BARRIER();
+
+    // Release all slots at once
+    _Tail = Tail + Count;
+
+    return Count;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint32_t Size>
+inline uint32_t SpscRing<T, Size>::GetCount()
+{
+    return _Head - _Tail;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint32_t Size>
+inline uint32_t SpscRing<T, Size>::GetDropped()
+{
+    return _Dropped;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T, uint32_t Size>
+void SpscRing<T, Size>::Clear()
+{
+    _Tail = _Head;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
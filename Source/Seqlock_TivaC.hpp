@@ -0,0 +1,210 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Sequence lock library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      Seqlock<T> publishes a snapshot of a struct written by one writer (usually an ISR) to any
+//      number of readers (usually the main loop) without disabling interrupts:
+//          - The writer makes the sequence counter odd, copies the struct and makes it even again. It
+//            never waits.
+//          - A reader copies the struct between two reads of the counter and retries if the counter
+//            was odd or has changed, i.e. if the writer ran in the middle of the copy.
+//          - A compiler barrier orders the copy against the counter accesses. This is enough on the
+//            single-core Cortex-M4; no hardware barrier is needed.
+
+//      Read may only be called from contexts the writer can preempt. A context that can preempt the
+//      writer (a higher priority ISR) would spin forever on an odd counter and must use TryRead.
+
+//      There must be only one writer at a time. Writes from a second context (e.g. a setter called
+//      from the main loop) must mask the writer interrupt around Write.
+
+//      Usage example (any struct works, e.g. stepper_status_t or rgb_color_t):
+//          Seqlock<encoder_data_t> Shared;
+//          Shared.Write(Data);             // ISR
+//          ...
+//          encoder_data_t Copy;
+//          Shared.Read(&Copy);             // Main loop
+//          int64_t Pos = Shared.ReadField(&encoder_data_t::PosAbs);
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef SEQLOCK_TIVAC_H_
+#define SEQLOCK_TIVAC_H_
+
+// Templates must have C++ linkage
+#ifdef __cplusplus
+extern "C++"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Compiler barrier - Keeps the copy between the counter accesses
+#if defined(__GNUC__) || defined(__clang__)
+#define SEQLOCK_BARRIER() __asm volatile ("" ::: "memory")
+#elif defined(__TI_COMPILER_VERSION__)
+#define SEQLOCK_BARRIER() __memory_changed()
+#else
+#error "Seqlock: no compiler barrier for this compiler"
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+class Seqlock
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        T _Value = T();                 // Published snapshot
+        volatile uint32_t _Seq = 0;     // Sequence counter - Odd while a write is in progress
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        Write
+        // Description: Publishes a new snapshot (writer side, wait-free)
+        // Arguments:   Value - Snapshot to be published
+        // Returns:     None
+        void Write(const T &Value);
+
+        // Name:        Read
+        // Description: Copies the last complete snapshot (reader side, retries while a write overlaps)
+        // Arguments:   Buffer - Variable to receive the snapshot
+        // Returns:     Number of retries
+        uint32_t Read(T *Buffer);
+
+        // Name:        TryRead
+        // Description: Copies the last complete snapshot once (reader side, never waits)
+        // Arguments:   Buffer - Variable to receive the snapshot
+        // Returns:     True if the copy is complete, false if a write overlapped it
+        bool TryRead(T *Buffer);
+
+        // Name:        ReadField
+        // Description: Copies one member of the last complete snapshot (reader side, retries while a
+        //              write overlaps)
+        // Arguments:   Member - Pointer to the member (e.g. &encoder_data_t::PosAbs)
+        // Returns:     The member value
+        template <typename M>
+        M ReadField(M T::*Member);
+
+        // Name:        GetSequence
+        // Description: Gets the sequence counter (increases by 2 on every write)
+        // Arguments:   None
+        // Returns:     The sequence counter
+        uint32_t GetSequence();
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+inline void Seqlock<T>::Write(const T &Value)
+{
+    uint32_t Seq = _Seq;
+
+    // Odd - Write in progress
+    _Seq = Seq + 1;
+    SEQLOCK_BARRIER();
+
+    _Value = Value;
+
+    // Even - Snapshot complete
+    SEQLOCK_BARRIER();
+    _Seq = Seq + 2;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+inline uint32_t Seqlock<T>::Read(T *Buffer)
+{
+    uint32_t Retries = 0;
+
+    while (!TryRead(Buffer))
+        Retries++;
+
+    return Retries;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+inline bool Seqlock<T>::TryRead(T *Buffer)
+{
+    uint32_t Seq = _Seq;
+
+    // Write in progress
+    if (Seq & 1)
+        return false;
+
+    // Copy must be read after the first and before the second counter access
+    SEQLOCK_BARRIER();
+    *Buffer = _Value;
+    SEQLOCK_BARRIER();
+
+    return (_Seq == Seq);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+template <typename M>
+inline M Seqlock<T>::ReadField(M T::*Member)
+{
+    uint32_t Seq;
+    M Value;
+
+    // Same as TryRead, but only the member is copied
+    do
+    {
+        Seq = _Seq;
+        SEQLOCK_BARRIER();
+        Value = _Value.*Member;
+        SEQLOCK_BARRIER();
+    }
+    while ((Seq & 1) || (_Seq != Seq));
+
+    return Value;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename T>
+inline uint32_t Seqlock<T>::GetSequence()
+{
+    return _Seq;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
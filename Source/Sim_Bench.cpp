@@ -0,0 +1,275 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Host controller benchmarks
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Benchmarks defines and macros
+#include "Sim_Bench.hpp"
+
+// Standard libraries
+#include <stdint.h>
+
+// Harness
+#include "Sim_Harness.hpp"
+
+// Controllers
+#include "PidT_TivaC.hpp"
+#include "LeadT_TivaC.hpp"
+#include "Biquad_TivaC.hpp"
+#include "ControllerSlot_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Adapters
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        NumberAdapter
+// Description: float Compute(float) over a controller with number type T
+//              The test signal is halved to stay inside [-1, 1)
+template <typename Ctrl, typename T>
+class NumberAdapter
+{
+    private:
+
+        Ctrl *_Controller;
+
+    public:
+
+        NumberAdapter(Ctrl *Controller) : _Controller(Controller) {}
+
+        float Compute(float Y)
+        {
+            return Num<T>::ToFloat(_Controller->Compute(Num<T>::FromFloat(Y * 0.5f, 0)));
+        }
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        NumberReference
+// Description: Same conversions as NumberAdapter without a controller (Overhead reference)
+template <typename T>
+class NumberReference
+{
+    public:
+
+        float Compute(float Y)
+        {
+            return Num<T>::ToFloat(Num<T>::FromFloat(Y * 0.5f, 0));
+        }
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        PassThrough
+// Description: Compute returns its input (Overhead reference of directly called objects)
+class PassThrough
+{
+    public:
+
+        float Compute(float Y)
+        {
+            return Y;
+        }
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        LqrDirect
+// Description: float Compute(float) over a direct Lqr::Compute() call (the measurement is not used)
+class LqrDirect
+{
+    private:
+
+        Lqr *_Controller;
+
+    public:
+
+        LqrDirect(Lqr *Controller) : _Controller(Controller) {}
+
+        float Compute(float Y)
+        {
+            (void)Y;
+            return _Controller->Compute();
+        }
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Static functions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _Measure
+// Description: Times one controller through its adapter
+// Arguments:   Controller - Controller with T Compute(T Y)
+//              Samples - Number of samples of each run
+//              Result - sim_bench_t struct to receive the result
+// Returns:     None
+
+template <typename T, typename Ctrl>
+static void _Measure(Ctrl *Controller, uint32_t Samples, sim_bench_t *Result)
+{
+    NumberAdapter<Ctrl, T> Adapter(Controller);
+    NumberReference<T> Reference;
+
+    Result->Msps = SimHarness::Throughput(&Adapter, Samples) * 1e-6f;
+    Result->NsPerCompute = SimHarness::Overhead(&Reference, &Adapter, Samples);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _Numbers
+// Description: Configures PidT and LeadT with number type T and times them
+// Arguments:   Samples - Number of samples of each run
+//              Pid - sim_bench_t struct to receive the PidT result
+//              Lead - sim_bench_t struct to receive the LeadT result
+// Returns:     None
+
+template <typename T>
+static void _Numbers(uint32_t Samples, sim_bench_t *Pid, sim_bench_t *Lead)
+{
+    T Min = Num<T>::FromFloat(-0.9f, 0);
+    T Max = Num<T>::FromFloat(0.9f, 0);
+
+    // Gains up to 4.0 - Scale 2
+    PidT<T> PidLoop;
+    PidLoop.SetScale(2);
+    PidLoop.SetGainsFloat(2.0f, 0.01f, 0.5f);
+    PidLoop.SetLimits(Min, Max);
+    PidLoop.SetReference(Num<T>::FromFloat(0.25f, 0));
+
+    LeadT<T> LeadLoop;
+    LeadLoop.SetScale(2);
+    LeadLoop.SetGainsFloat(0.9f, 1.5f, -1.3f);
+    LeadLoop.SetLimits(Min, Max);
+    LeadLoop.SetReference(Num<T>::FromFloat(0.25f, 0));
+
+    _Measure<T>(&PidLoop, Samples, Pid);
+    _Measure<T>(&LeadLoop, Samples, Lead);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _Biquad
+// Description: Configures a BiquadCascade with N sections and times it
+// Arguments:   Samples - Number of samples of each run
+//              Result - sim_bench_t struct to receive the result
+// Returns:     None
+
+template <uint8_t N>
+static void _Biquad(uint32_t Samples, sim_bench_t *Result)
+{
+    BiquadCascade<N> Loop;
+    PassThrough Reference;
+
+    // Second-order Butterworth low-pass at 0.1 fs in every section (unity DC gain)
+    for (uint8_t Idx = 0; Idx < N; Idx++)
+        Loop.SetSection(Idx, 0.0675f, 0.1349f, 0.0675f, -1.1430f, 0.4128f);
+
+    Loop.SetLimits(-10.0f, 10.0f);
+
+    Result->Msps = SimHarness::Throughput(&Loop, Samples) * 1e-6f;
+    Result->NsPerCompute = SimHarness::Overhead(&Reference, &Loop, Samples);
+}
+
+// Name:        _Slot
+// Description: Times a ControllerSlot holding a controller against the direct calls
+// Arguments:   Direct - Controller (or adapter) with float Compute(float Y)
+//              Slot - Slot holding the same controller
+//              Samples - Number of samples of each run
+//              Result - sim_bench_t struct to receive the result
+// Returns:     None
+
+template <typename Ctrl>
+static void _Slot(Ctrl *Direct, ControllerSlot *Slot, uint32_t Samples, sim_bench_t *Result)
+{
+    Result->Msps = SimHarness::Throughput(Slot, Samples) * 1e-6f;
+    Result->NsPerCompute = SimHarness::Overhead(Direct, Slot, Samples);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Numbers
+// Description: Times PidT and LeadT with float, Q31 and Q15 numbers
+// Arguments:   Samples - Number of samples of each run
+//              Result - sim_bench_numbers_t struct to receive the results
+// Returns:     None
+
+void SimBench::Numbers(uint32_t Samples, sim_bench_numbers_t *Result)
+{
+    if (Result == nullptr)
+        return;
+
+    _Numbers<float>(Samples, &Result->Pid[SIM_BENCH_FLOAT], &Result->Lead[SIM_BENCH_FLOAT]);
+    _Numbers<q31_t>(Samples, &Result->Pid[SIM_BENCH_Q31], &Result->Lead[SIM_BENCH_Q31]);
+    _Numbers<q15_t>(Samples, &Result->Pid[SIM_BENCH_Q15], &Result->Lead[SIM_BENCH_Q15]);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Biquad
+// Description: Times BiquadCascade with 1 to SIM_BENCH_BIQUAD_SECTIONS sections
+// Arguments:   Samples - Number of samples of each run
+//              Result - SIM_BENCH_BIQUAD_SECTIONS sim_bench_t structs to receive the results
+//                       (Result[N - 1] for N sections)
+// Returns:     None
+
+void SimBench::Biquad(uint32_t Samples, sim_bench_t *Result)
+{
+    if (Result == nullptr)
+        return;
+
+    _Biquad<1>(Samples, &Result[0]);
+    _Biquad<2>(Samples, &Result[1]);
+    _Biquad<3>(Samples, &Result[2]);
+    _Biquad<4>(Samples, &Result[3]);
+    _Biquad<5>(Samples, &Result[4]);
+    _Biquad<6>(Samples, &Result[5]);
+    _Biquad<7>(Samples, &Result[6]);
+    _Biquad<8>(Samples, &Result[7]);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Slot
+// Description: Times ControllerSlot against direct Pid, Lead and Lqr calls
+// Arguments:   Samples - Number of samples of each run
+//              Result - sim_bench_slot_t struct to receive the results
+// Returns:     None
+
+void SimBench::Slot(uint32_t Samples, sim_bench_slot_t *Result)
+{
+    if (Result == nullptr)
+        return;
+
+    const float Gains[4] = {2.0f, 0.5f, 8.0f, 1.0f};
+    const float Refs[4] = {0.25f, 0, 0, 0};
+    const float States[4] = {0.1f, -0.2f, 0.05f, 0.3f};
+
+    Pid PidLoop(2.0f, 0.01f, 0.5f, 0.25f, -5.0f, 5.0f);
+    Lead LeadLoop(0.9f, 1.5f, -1.3f, 0.25f, -5.0f, 5.0f);
+    Lqr LqrLoop(Gains, Refs, 4, -5.0f, 5.0f);
+    LqrDirect LqrCall(&LqrLoop);
+    ControllerSlot Holder;
+
+    LqrLoop.SetStates(States);
+
+    Holder.Select(&PidLoop, false);
+    _Slot(&PidLoop, &Holder, Samples, &Result->Pid);
+
+    Holder.Select(&LeadLoop, false);
+    _Slot(&LeadLoop, &Holder, Samples, &Result->Lead);
+
+    Holder.Select(&LqrLoop, false);
+    _Slot(&LqrCall, &Holder, Samples, &Result->Lqr);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
@@ -0,0 +1,145 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Host controller benchmarks
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      This library times the controllers on the host with SimHarness::Throughput and
+//      SimHarness::Overhead, next to the simulation harness.
+
+//      Numbers compares PidT and LeadT with float, Q31 and Q15 numbers. Throughput only drives objects
+//      with float Compute(float), so each controller is called through an adapter that converts the
+//      test signal to its number type and the output back to float. The same adapter without the
+//      controller is the Overhead reference, so NsPerCompute is the time of Compute alone.
+
+//      Biquad times BiquadCascade<N> with 1 to SIM_BENCH_BIQUAD_SECTIONS sections, called directly
+//      through Compute. The Overhead reference is an object whose Compute returns its input.
+
+//      Slot times a ControllerSlot holding a Pid, a Lead and a Lqr. The Overhead reference is the same
+//      controller called directly (Lqr::Compute() through an adapter that drops the measurement), so
+//      NsPerCompute is the cost of the jump table dispatch alone.
+
+//      Host times show the relative cost of the number types and section counts; cycles on the target
+//      are measured with Wcet.
+
+//      Usage example:
+//          sim_bench_numbers_t Result;
+//          SimBench::Numbers(10000000, &Result);
+//          float Ns = Result.Pid[SIM_BENCH_Q15].NsPerCompute;
+//          ...
+//          sim_bench_t Sections[SIM_BENCH_BIQUAD_SECTIONS];
+//          SimBench::Biquad(10000000, Sections);           // Sections[N - 1]: N sections
+//          ...
+//          sim_bench_slot_t Slot;
+//          SimBench::Slot(10000000, &Slot);                // Slot.Pid.NsPerCompute: dispatch cost
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef SIM_BENCH_H_
+#define SIM_BENCH_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#define SIM_BENCH_BIQUAD_SECTIONS 8     // Largest BiquadCascade timed by Biquad
+
+// ------------------------------------------------------------------------------------------------------- //
+// Program enumerations
+// ------------------------------------------------------------------------------------------------------- //
+
+// Number types
+typedef enum
+{
+    SIM_BENCH_FLOAT = 0,            // float
+    SIM_BENCH_Q31,                  // q31_t
+    SIM_BENCH_Q15,                  // q15_t
+    SIM_BENCH_TYPES                 // Number of number types
+} sim_bench_type_t;
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// Benchmark result
+typedef struct
+{
+    float Msps;                     // Samples per second through the adapter (millions), 0 if no clock
+    float NsPerCompute;             // Time of Compute alone (ns), 0 if no clock is available
+} sim_bench_t;
+
+// Number types benchmark results - Indexed by sim_bench_type_t
+typedef struct
+{
+    sim_bench_t Pid[SIM_BENCH_TYPES];   // PidT
+    sim_bench_t Lead[SIM_BENCH_TYPES];  // LeadT
+} sim_bench_numbers_t;
+
+// ControllerSlot benchmark results - Msps through the slot, NsPerCompute over a direct call
+typedef struct
+{
+    sim_bench_t Pid;                // Slot holding a Pid
+    sim_bench_t Lead;               // Slot holding a Lead
+    sim_bench_t Lqr;                // Slot holding a Lqr
+} sim_bench_slot_t;
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+class SimBench
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        Numbers
+        // Description: Times PidT and LeadT with float, Q31 and Q15 numbers
+        // Arguments:   Samples - Number of samples of each run
+        //              Result - sim_bench_numbers_t struct to receive the results
+        // Returns:     None
+        static void Numbers(uint32_t Samples, sim_bench_numbers_t *Result);
+
+        // Name:        Biquad
+        // Description: Times BiquadCascade with 1 to SIM_BENCH_BIQUAD_SECTIONS sections
+        // Arguments:   Samples - Number of samples of each run
+        //              Result - SIM_BENCH_BIQUAD_SECTIONS sim_bench_t structs to receive the results
+        //                       (Result[N - 1] for N sections)
+        // Returns:     None
+        static void Biquad(uint32_t Samples, sim_bench_t *Result);
+
+        // Name:        Slot
+        // Description: Times ControllerSlot against direct Pid, Lead and Lqr calls
+        // Arguments:   Samples - Number of samples of each run
+        //              Result - sim_bench_slot_t struct to receive the results
+        // Returns:     None
+        static void Slot(uint32_t Samples, sim_bench_slot_t *Result);
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
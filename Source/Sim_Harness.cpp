@@ -0,0 +1,115 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Closed-loop simulation harness
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Harness defines and macros
+#include "Sim_Harness.hpp"
+
+// Standard libraries
+#include <stdint.h>
+
+// Host monotonic clock
+#if defined(__unix__) || defined(__APPLE__)
+#include <time.h>
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions - StepMetrics
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Init
+// Description: Starts a new step response
+// Arguments:   Y0 - Initial output
+//              Ref - Reference
+//              Ts - Sample time (s)
+// Returns:     None
+
+void StepMetrics::Init(float Y0, float Ref, float Ts)
+{
+    _Y0 = Y0;
+    _Ref = Ref;
+    _InvStep = (Ref != Y0) ? 1.0f / (Ref - Y0) : 0;
+    _Ts = Ts;
+    _Steps = 0;
+    _Step10 = -1;
+    _Step90 = -1;
+    _PeakFrac = 0;
+    _Iae = 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Add
+// Description: Adds one output sample
+// Arguments:   Y - Plant output
+// Returns:     None
+
+void StepMetrics::Add(float Y)
+{
+    // Progress as a fraction of the step (works for negative steps)
+    float Frac = (Y - _Y0) * _InvStep;
+
+    // Rise time crossings
+    if ((_Step10 < 0) && (Frac >= 0.1f))
+        _Step10 = _Steps;
+
+    if ((_Step90 < 0) && (Frac >= 0.9f))
+        _Step90 = _Steps;
+
+    // Peak
+    if (Frac > _PeakFrac)
+        _PeakFrac = Frac;
+
+    // Integral of the absolute error
+    float E = _Ref - Y;
+    _Iae += (double)(E < 0 ? -E : E) * _Ts;
+
+    _Steps++;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetResult
+// Description: Gets the step response metrics
+// Arguments:   Result - sim_result_t struct to receive the data (NsPerStep is not changed)
+// Returns:     None
+
+void StepMetrics::GetResult(sim_result_t *Result)
+{
+    Result->Steps = _Steps;
+    Result->RiseTime = ((_Step10 >= 0) && (_Step90 >= 0)) ? (_Step90 - _Step10) * _Ts : -1;
+    Result->Overshoot = (_PeakFrac > 1.0f) ? (_PeakFrac - 1.0f) * 100.0f : 0;
+    Result->Iae = (float)_Iae;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions - SimHarness
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Nanoseconds
+// Description: Reads the host monotonic clock
+// Arguments:   None
+// Returns:     Time in ns (0 if no clock is available)
+
+uint64_t SimHarness::Nanoseconds()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    struct timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return (uint64_t)Now.tv_sec * 1000000000ULL + (uint64_t)Now.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------------- //
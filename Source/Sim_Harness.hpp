@@ -0,0 +1,287 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Closed-loop simulation harness
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      This library runs a controller (Pid, Lead, Lqr or any class with the same Compute interface)
+//      against one of the plant models of Sim_Plants.hpp in closed loop, and reports both speed and
+//      control quality of the run:
+//          - Time per step (ns, controller + plant + metrics), measured with the host monotonic clock
+//          - Rise time (10% to 90% of the step)
+//          - Overshoot (% of the step)
+//          - Integral of the absolute error (IAE)
+
+//      The run starts from the current controller and plant states with the plant output at 0, so the
+//      reference set in the controller is the step. Runs of millions of steps are supported; the
+//      metrics are updated incrementally and use no storage per step.
+
+//      Throughput runs time any controller or filter with float Compute(float) in open loop, fed with
+//      a fixed test signal, and report samples per second. Overhead compares two such objects (e.g. a
+//      ControllerSlot against the controller it holds) and reports the extra time per sample.
+
+//      Usage example:
+//          Pid Controller(2.0f, 0.01f, 0.5f, 1.0f, -5.0f, 5.0f);
+//          PlantFopdt Model;
+//          sim_result_t Result;
+//          Model.Init(1.0f, 0.5f, 20, 0.001f);
+//          SimHarness::Run(&Controller, &Model, 1000000, 0.001f, &Result);
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef SIM_HARNESS_H_
+#define SIM_HARNESS_H_
+
+// Templates must have C++ linkage
+#ifdef __cplusplus
+extern "C++"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#define SIM_OVERHEAD_ROUNDS 5           // Alternating runs of Overhead (the fastest of each is kept)
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// Simulation results
+typedef struct
+{
+    uint32_t Steps;                 // Number of simulated steps
+    float NsPerStep;                // Time per step (ns), 0 if no clock is available
+    float RiseTime;                 // Rise time, 10% to 90% of the step (s), -1 if not reached
+    float Overshoot;                // Overshoot (% of the step)
+    float Iae;                      // Integral of the absolute error
+} sim_result_t;
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototypes
+// ------------------------------------------------------------------------------------------------------- //
+
+class StepMetrics
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        float _Y0 = 0;              // Initial output
+        float _Ref = 0;             // Reference
+        float _InvStep = 0;         // Inverse of the step size
+        float _Ts = 0;              // Sample time (s)
+        uint32_t _Steps = 0;        // Step counter
+        int32_t _Step10 = -1;       // Step where 10% of the step was reached
+        int32_t _Step90 = -1;       // Step where 90% of the step was reached
+        float _PeakFrac = 0;        // Peak output as a fraction of the step
+        double _Iae = 0;            // Integral of the absolute error (double - millions of small terms)
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        Init
+        // Description: Starts a new step response
+        // Arguments:   Y0 - Initial output
+        //              Ref - Reference
+        //              Ts - Sample time (s)
+        // Returns:     None
+        void Init(float Y0, float Ref, float Ts);
+
+        // Name:        Add
+        // Description: Adds one output sample
+        // Arguments:   Y - Plant output
+        // Returns:     None
+        void Add(float Y);
+
+        // Name:        GetResult
+        // Description: Gets the step response metrics
+        // Arguments:   Result - sim_result_t struct to receive the data (NsPerStep is not changed)
+        // Returns:     None
+        void GetResult(sim_result_t *Result);
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+class SimHarness
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        Nanoseconds
+        // Description: Reads the host monotonic clock
+        // Arguments:   None
+        // Returns:     Time in ns (0 if no clock is available)
+        static uint64_t Nanoseconds();
+
+        // Name:        Run
+        // Description: Runs an output-feedback controller (Pid, Lead) in closed loop
+        // Arguments:   Controller - Controller with float Compute(float Y) and float GetReference()
+        //              Model - Plant with float Step(float U)
+        //              Steps - Number of steps
+        //              Ts - Sample time (s)
+        //              Result - sim_result_t struct to receive the results
+        // Returns:     None
+        template <typename Ctrl, typename Plant>
+        static void Run(Ctrl *Controller, Plant *Model, uint32_t Steps, float Ts, sim_result_t *Result);
+
+        // Name:        RunStateFeedback
+        // Description: Runs a state-feedback controller (Lqr) in closed loop
+        //              The metrics are computed on state 0 against reference 0
+        // Arguments:   Controller - Controller with GetReference and float Compute(const float *States)
+        //              Model - Plant with float Step(float U) and GetState(float *)
+        //              Steps - Number of steps
+        //              Ts - Sample time (s)
+        //              Result - sim_result_t struct to receive the results
+        // Returns:     None
+        template <uint8_t N, typename Ctrl, typename Plant>
+        static void RunStateFeedback(Ctrl *Controller, Plant *Model, uint32_t Steps, float Ts, sim_result_t *Result);
+
+        // Name:        Throughput
+        // Description: Runs a controller or filter in open loop and measures its speed
+        // Arguments:   Controller - Controller or filter with float Compute(float Y)
+        //              Samples - Number of samples
+        // Returns:     Samples per second (0 if no clock is available)
+        template <typename Ctrl>
+        static float Throughput(Ctrl *Controller, uint32_t Samples);
+
+        // Name:        Overhead
+        // Description: Measures the extra time per sample of a wrapped controller against a direct one
+        // Arguments:   Reference - Controller called directly, with float Compute(float Y)
+        //              Test - Wrapper (or other controller) with float Compute(float Y)
+        //              Samples - Number of samples of each run
+        // Returns:     Extra time per sample of Test (ns, negative if faster, 0 if no clock is available)
+        template <typename Direct, typename Wrapped>
+        static float Overhead(Direct *Reference, Wrapped *Test, uint32_t Samples);
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename Ctrl, typename Plant>
+void SimHarness::Run(Ctrl *Controller, Plant *Model, uint32_t Steps, float Ts, sim_result_t *Result)
+{
+    StepMetrics Metrics;
+    Metrics.Init(0, Controller->GetReference(), Ts);
+
+    float Y = 0;
+    uint64_t Start = Nanoseconds();
+
+    for (uint32_t Step = 0; Step < Steps; Step++)
+    {
+        Y = Model->Step(Controller->Compute(Y));
+        Metrics.Add(Y);
+    }
+
+    uint64_t Elapsed = Nanoseconds() - Start;
+
+    Metrics.GetResult(Result);
+    Result->NsPerStep = (Steps > 0) ? (float)Elapsed / Steps : 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <uint8_t N, typename Ctrl, typename Plant>
+void SimHarness::RunStateFeedback(Ctrl *Controller, Plant *Model, uint32_t Steps, float Ts, sim_result_t *Result)
+{
+    StepMetrics Metrics;
+    float State[N];
+
+    Model->GetState(State);
+    Metrics.Init(State[0], Controller->GetReference(0), Ts);
+
+    uint64_t Start = Nanoseconds();
+
+    for (uint32_t Step = 0; Step < Steps; Step++)
+    {
+        Model->Step(Controller->Compute(State));
+        Model->GetState(State);
+        Metrics.Add(State[0]);
+    }
+
+    uint64_t Elapsed = Nanoseconds() - Start;
+
+    Metrics.GetResult(Result);
+    Result->NsPerStep = (Steps > 0) ? (float)Elapsed / Steps : 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename Ctrl>
+float SimHarness::Throughput(Ctrl *Controller, uint32_t Samples)
+{
+    // Outputs are summed into a volatile so the loop is not optimized away
+    volatile float Sink = 0;
+    float Sum = 0;
+    float Y = 0;
+
+    uint64_t Start = Nanoseconds();
+
+    for (uint32_t Sample = 0; Sample < Samples; Sample++)
+    {
+        // Triangle test signal (period 256 samples)
+        Y = ((Sample & 0xFF) < 0x80) ? Y + 0.01f : Y - 0.01f;
+        Sum += Controller->Compute(Y);
+    }
+
+    uint64_t Elapsed = Nanoseconds() - Start;
+    Sink = Sum;
+    (void)Sink;
+
+    return (Elapsed > 0) ? (float)Samples * 1e9f / (float)Elapsed : 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+template <typename Direct, typename Wrapped>
+float SimHarness::Overhead(Direct *Reference, Wrapped *Test, uint32_t Samples)
+{
+    float BestReference = 0;
+    float BestTest = 0;
+
+    // Alternating runs - Both see the same cache and frequency conditions
+    for (uint8_t Round = 0; Round < SIM_OVERHEAD_ROUNDS; Round++)
+    {
+        float Rate = Throughput(Reference, Samples);
+        BestReference = (Rate > BestReference) ? Rate : BestReference;
+
+        Rate = Throughput(Test, Samples);
+        BestTest = (Rate > BestTest) ? Rate : BestTest;
+    }
+
+    if ((BestReference <= 0) || (BestTest <= 0))
+        return 0;
+
+    return 1e9f / BestTest - 1e9f / BestReference;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
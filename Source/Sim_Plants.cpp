@@ -0,0 +1,312 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Discrete plant models for closed-loop simulation
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Plant defines and macros
+#include "Sim_Plants.hpp"
+
+// Standard libraries
+#include <stdint.h>
+#include <math.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions - PlantFopdt
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Init
+// Description: Sets the plant parameters and resets its state
+// Arguments:   K - Static gain
+//              Tau - Time constant (s)
+//              Delay - Dead time (samples, up to MAX_PLANT_DELAY)
+//              Ts - Sample time (s)
+// Returns:     None
+
+void PlantFopdt::Init(float K, float Tau, uint16_t Delay, float Ts)
+{
+    // Zero-order-hold discretization
+    _A = expf(-Ts / Tau);
+    _B = K * (1.0f - _A);
+
+    _Delay = (Delay < MAX_PLANT_DELAY) ? Delay : MAX_PLANT_DELAY;
+
+    Reset();
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Step
+// Description: Advances the plant one sample
+// Arguments:   U - Plant input
+// Returns:     Plant output
+
+float PlantFopdt::Step(float U)
+{
+    // Dead time
+    if (_Delay > 0)
+    {
+        float U_dly = _U[_Idx];
+        _U[_Idx] = U;
+
+        if (++_Idx >= _Delay)
+            _Idx = 0;
+
+        U = U_dly;
+    }
+
+    // First order dynamics
+    _Y = _A * _Y + _B * U;
+
+    return _Y;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Reset
+// Description: Resets the plant state
+// Arguments:   None
+// Returns:     None
+
+void PlantFopdt::Reset()
+{
+    _Y = 0;
+    _Idx = 0;
+
+    for (uint16_t Idx = 0; Idx < MAX_PLANT_DELAY; Idx++)
+        _U[Idx] = 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions - PlantDcMotor
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Init
+// Description: Sets the plant parameters and resets its state
+// Arguments:   R - Armature resistance (ohm)
+//              L - Armature inductance (H)
+//              Ke - Back-EMF constant (V.s/rad)
+//              Kt - Torque constant (N.m/A)
+//              J - Rotor inertia (kg.m^2)
+//              B - Viscous friction (N.m.s/rad)
+//              Ts - Sample time (s)
+// Returns:     None
+
+void PlantDcMotor::Init(float R, float L, float Ke, float Kt, float J, float B, float Ts)
+{
+    _R = R;
+    _L = L;
+    _Ke = Ke;
+    _Kt = Kt;
+    _J = J;
+    _B = B;
+    _Dt = Ts / PLANT_SUBSTEPS;
+
+    Reset();
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Step
+// Description: Advances the plant one sample
+// Arguments:   U - Armature voltage (V)
+// Returns:     Speed (rad/s)
+
+float PlantDcMotor::Step(float U)
+{
+    for (uint8_t Sub = 0; Sub < PLANT_SUBSTEPS; Sub++)
+    {
+        // Electrical dynamics - L di/dt = V - R i - Ke w
+        _I += _Dt * (U - _R * _I - _Ke * _W) / _L;
+
+        // Mechanical dynamics - J dw/dt = Kt i - B w
+        _W += _Dt * (_Kt * _I - _B * _W) / _J;
+    }
+
+    return _W;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetCurrent
+// Description: Gets the armature current
+// Arguments:   None
+// Returns:     Armature current (A)
+
+float PlantDcMotor::GetCurrent()
+{
+    return _I;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Reset
+// Description: Resets the plant state
+// Arguments:   None
+// Returns:     None
+
+void PlantDcMotor::Reset()
+{
+    _I = 0;
+    _W = 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions - PlantMsd
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Init
+// Description: Sets the plant parameters and resets its state
+// Arguments:   M - Mass (kg)
+//              C - Damping (N.s/m)
+//              K - Stiffness (N/m)
+//              Ts - Sample time (s)
+// Returns:     None
+
+void PlantMsd::Init(float M, float C, float K, float Ts)
+{
+    _M = M;
+    _C = C;
+    _K = K;
+    _Dt = Ts / PLANT_SUBSTEPS;
+
+    Reset();
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Step
+// Description: Advances the plant one sample
+// Arguments:   U - Force (N)
+// Returns:     Position (m)
+
+float PlantMsd::Step(float U)
+{
+    for (uint8_t Sub = 0; Sub < PLANT_SUBSTEPS; Sub++)
+    {
+        // m dv/dt = F - c v - k x
+        _V += _Dt * (U - _C * _V - _K * _X) / _M;
+        _X += _Dt * _V;
+    }
+
+    return _X;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Reset
+// Description: Resets the plant state
+// Arguments:   None
+// Returns:     None
+
+void PlantMsd::Reset()
+{
+    _X = 0;
+    _V = 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions - PlantPendulum
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Init
+// Description: Sets the plant parameters and resets its state
+// Arguments:   Mc - Cart mass (kg)
+//              Mp - Pendulum mass (kg)
+//              L - Pendulum length to the center of mass (m)
+//              B - Cart friction (N.s/m)
+//              Ts - Sample time (s)
+// Returns:     None
+
+void PlantPendulum::Init(float Mc, float Mp, float L, float B, float Ts)
+{
+    _Mc = Mc;
+    _Mp = Mp;
+    _L = L;
+    _B = B;
+    _Dt = Ts / PLANT_SUBSTEPS;
+
+    Reset();
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Step
+// Description: Advances the plant one sample (nonlinear point-mass pendulum)
+// Arguments:   U - Force applied to the cart (N)
+// Returns:     Cart position (m)
+
+float PlantPendulum::Step(float U)
+{
+    const float G = 9.81f;
+
+    for (uint8_t Sub = 0; Sub < PLANT_SUBSTEPS; Sub++)
+    {
+        float Sin = sinf(_State[2]);
+        float Cos = cosf(_State[2]);
+
+        // Cart acceleration
+        float Ddx = (U - _B * _State[1] - _Mp * G * Sin * Cos + _Mp * _L * _State[3] * _State[3] * Sin)
+                  / (_Mc + _Mp - _Mp * Cos * Cos);
+
+        // Pendulum angular acceleration
+        float Ddtheta = (G * Sin - Ddx * Cos) / _L;
+
+        // Integrate
+        _State[1] += _Dt * Ddx;
+        _State[0] += _Dt * _State[1];
+        _State[3] += _Dt * Ddtheta;
+        _State[2] += _Dt * _State[3];
+    }
+
+    return _State[0];
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetState
+// Description: Gets the plant states
+// Arguments:   Buffer - Buffer to receive the 4 states
+// Returns:     None
+
+void PlantPendulum::GetState(float *Buffer)
+{
+    for (uint8_t Idx = 0; Idx < 4; Idx++)
+        Buffer[Idx] = _State[Idx];
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetState
+// Description: Sets the plant states (initial condition)
+// Arguments:   State - Buffer with the 4 states
+// Returns:     None
+
+void PlantPendulum::SetState(const float *State)
+{
+    for (uint8_t Idx = 0; Idx < 4; Idx++)
+        _State[Idx] = State[Idx];
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Reset
+// Description: Resets the plant state
+// Arguments:   None
+// Returns:     None
+
+void PlantPendulum::Reset()
+{
+    for (uint8_t Idx = 0; Idx < 4; Idx++)
+        _State[Idx] = 0;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
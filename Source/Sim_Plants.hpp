@@ -0,0 +1,230 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Discrete plant models for closed-loop simulation
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      This library provides discrete-time plant models used to exercise the controllers (Pid, Lead,
+//      Lqr) in closed loop without hardware. Every plant advances one controller sample per Step call
+//      and returns the measured output. Continuous dynamics are integrated with a fixed number of
+//      semi-implicit Euler substeps per sample; the first-order plant uses the exact zero-order-hold
+//      discretization.
+
+//      Plants:
+//          PlantFopdt      First order plus dead time:   K e^(-Ls) / (Tau s + 1)
+//          PlantDcMotor    Armature-controlled DC motor:  input voltage, output speed (rad/s)
+//          PlantMsd        Mass-spring-damper:            input force, output position (m)
+//          PlantPendulum   Inverted pendulum on a cart:   input force, states [x, dx, theta, dtheta]
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef SIM_PLANTS_H_
+#define SIM_PLANTS_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#define MAX_PLANT_DELAY 256             // Maximum dead time of PlantFopdt (samples)
+#define PLANT_SUBSTEPS 10               // Integration substeps per sample
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototypes
+// ------------------------------------------------------------------------------------------------------- //
+
+class PlantFopdt
+{
+    private:
+
+        float _A = 0;                   // Pole (e^(-Ts / Tau))
+        float _B = 0;                   // Input gain (K * (1 - A))
+        float _Y = 0;                   // Output
+        float _U[MAX_PLANT_DELAY] = {0};// Input delay line
+        uint16_t _Delay = 0;            // Dead time (samples)
+        uint16_t _Idx = 0;              // Delay line index
+
+    public:
+
+        // Name:        Init
+        // Description: Sets the plant parameters and resets its state
+        // Arguments:   K - Static gain
+        //              Tau - Time constant (s)
+        //              Delay - Dead time (samples, up to MAX_PLANT_DELAY)
+        //              Ts - Sample time (s)
+        // Returns:     None
+        void Init(float K, float Tau, uint16_t Delay, float Ts);
+
+        // Name:        Step
+        // Description: Advances the plant one sample
+        // Arguments:   U - Plant input
+        // Returns:     Plant output
+        float Step(float U);
+
+        // Name:        Reset
+        // Description: Resets the plant state
+        // Arguments:   None
+        // Returns:     None
+        void Reset();
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+class PlantDcMotor
+{
+    private:
+
+        float _R = 0;                   // Armature resistance (ohm)
+        float _L = 0;                   // Armature inductance (H)
+        float _Ke = 0;                  // Back-EMF constant (V.s/rad)
+        float _Kt = 0;                  // Torque constant (N.m/A)
+        float _J = 0;                   // Rotor inertia (kg.m^2)
+        float _B = 0;                   // Viscous friction (N.m.s/rad)
+        float _Dt = 0;                  // Integration substep (s)
+        float _I = 0;                   // Armature current (A)
+        float _W = 0;                   // Speed (rad/s)
+
+    public:
+
+        // Name:        Init
+        // Description: Sets the plant parameters and resets its state
+        // Arguments:   R - Armature resistance (ohm)
+        //              L - Armature inductance (H)
+        //              Ke - Back-EMF constant (V.s/rad)
+        //              Kt - Torque constant (N.m/A)
+        //              J - Rotor inertia (kg.m^2)
+        //              B - Viscous friction (N.m.s/rad)
+        //              Ts - Sample time (s)
+        // Returns:     None
+        void Init(float R, float L, float Ke, float Kt, float J, float B, float Ts);
+
+        // Name:        Step
+        // Description: Advances the plant one sample
+        // Arguments:   U - Armature voltage (V)
+        // Returns:     Speed (rad/s)
+        float Step(float U);
+
+        // Name:        GetCurrent
+        // Description: Gets the armature current
+        // Arguments:   None
+        // Returns:     Armature current (A)
+        float GetCurrent();
+
+        // Name:        Reset
+        // Description: Resets the plant state
+        // Arguments:   None
+        // Returns:     None
+        void Reset();
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+class PlantMsd
+{
+    private:
+
+        float _M = 0;                   // Mass (kg)
+        float _C = 0;                   // Damping (N.s/m)
+        float _K = 0;                   // Stiffness (N/m)
+        float _Dt = 0;                  // Integration substep (s)
+        float _X = 0;                   // Position (m)
+        float _V = 0;                   // Velocity (m/s)
+
+    public:
+
+        // Name:        Init
+        // Description: Sets the plant parameters and resets its state
+        // Arguments:   M - Mass (kg)
+        //              C - Damping (N.s/m)
+        //              K - Stiffness (N/m)
+        //              Ts - Sample time (s)
+        // Returns:     None
+        void Init(float M, float C, float K, float Ts);
+
+        // Name:        Step
+        // Description: Advances the plant one sample
+        // Arguments:   U - Force (N)
+        // Returns:     Position (m)
+        float Step(float U);
+
+        // Name:        Reset
+        // Description: Resets the plant state
+        // Arguments:   None
+        // Returns:     None
+        void Reset();
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+class PlantPendulum
+{
+    private:
+
+        float _Mc = 0;                  // Cart mass (kg)
+        float _Mp = 0;                  // Pendulum mass (kg)
+        float _L = 0;                   // Pendulum length to the center of mass (m)
+        float _B = 0;                   // Cart friction (N.s/m)
+        float _Dt = 0;                  // Integration substep (s)
+        float _State[4] = {0};          // States [x (m), dx (m/s), theta (rad, 0 = upright), dtheta (rad/s)]
+
+    public:
+
+        // Name:        Init
+        // Description: Sets the plant parameters and resets its state
+        // Arguments:   Mc - Cart mass (kg)
+        //              Mp - Pendulum mass (kg)
+        //              L - Pendulum length to the center of mass (m)
+        //              B - Cart friction (N.s/m)
+        //              Ts - Sample time (s)
+        // Returns:     None
+        void Init(float Mc, float Mp, float L, float B, float Ts);
+
+        // Name:        Step
+        // Description: Advances the plant one sample
+        // Arguments:   U - Force applied to the cart (N)
+        // Returns:     Cart position (m)
+        float Step(float U);
+
+        // Name:        GetState
+        // Description: Gets the plant states
+        // Arguments:   Buffer - Buffer to receive the 4 states
+        // Returns:     None
+        void GetState(float *Buffer);
+
+        // Name:        SetState
+        // Description: Sets the plant states (initial condition)
+        // Arguments:   State - Buffer with the 4 states
+        // Returns:     None
+        void SetState(const float *State);
+
+        // Name:        Reset
+        // Description: Resets the plant state
+        // Arguments:   None
+        // Returns:     None
+        void Reset();
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
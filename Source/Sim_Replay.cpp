@@ -0,0 +1,241 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Host edge-stream replay tests
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Replay tests defines and macros
+#include "Sim_Replay.hpp"
+
+// Standard libraries
+#include <stdint.h>
+
+// Software encoder
+#include "SoftEncoder_TivaC.hpp"
+
+// Host clock
+#include "Sim_Harness.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+// Stream buffer
+#include <vector>
+
+// TivaC device defines and macros - Modeled below
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Static variables
+// ------------------------------------------------------------------------------------------------------- //
+
+static uint8_t _PortValue = 0;                  // Current pin levels of the replayed port
+static void (*_PortHandler)(void) = nullptr;    // Handler registered for the replayed port
+
+static SoftEncoder _Encoders[SIM_REPLAY_ENCODERS];  // Encoders under test
+static bool _Ready = false;                     // Encoders added to the port
+static uint8_t _Phase[SIM_REPLAY_ENCODERS];     // Quadrature phase of each encoder (0 to 3)
+static uint32_t _Seed = 12345;                  // Stream generator state
+
+// Quadrature states - Forward sequence, state = (A << 1) | B
+static const uint8_t _Sequence[4] = {0, 2, 3, 1};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Host model of the device functions used by SoftEncoder
+// ------------------------------------------------------------------------------------------------------- //
+
+void SysCtlPeripheralEnable(uint32_t Peripheral)
+{
+    (void)Peripheral;
+}
+
+bool SysCtlPeripheralReady(uint32_t Peripheral)
+{
+    (void)Peripheral;
+    return true;
+}
+
+void GPIOUnlockPin(uint32_t Port, uint8_t Pins)
+{
+    (void)Port;
+    (void)Pins;
+}
+
+void GPIOPinTypeGPIOInput(uint32_t Port, uint8_t Pins)
+{
+    (void)Port;
+    (void)Pins;
+}
+
+void GPIOPadConfigSet(uint32_t Port, uint8_t Pins, uint32_t Strength, uint32_t PadType)
+{
+    (void)Port;
+    (void)Pins;
+    (void)Strength;
+    (void)PadType;
+}
+
+void GPIOIntTypeSet(uint32_t Port, uint8_t Pins, uint32_t IntType)
+{
+    (void)Port;
+    (void)Pins;
+    (void)IntType;
+}
+
+void GPIOIntRegister(uint32_t Port, void (*Handler)(void))
+{
+    (void)Port;
+    _PortHandler = Handler;
+}
+
+void GPIOIntEnable(uint32_t Port, uint32_t IntFlags)
+{
+    (void)Port;
+    (void)IntFlags;
+}
+
+void GPIOIntDisable(uint32_t Port, uint32_t IntFlags)
+{
+    (void)Port;
+    (void)IntFlags;
+}
+
+void GPIOIntClear(uint32_t Port, uint32_t IntFlags)
+{
+    (void)Port;
+    (void)IntFlags;
+}
+
+int32_t GPIOPinRead(uint32_t Port, uint8_t Pins)
+{
+    (void)Port;
+    return _PortValue & Pins;
+}
+
+bool IntMasterDisable(void)
+{
+    return false;
+}
+
+bool IntMasterEnable(void)
+{
+    return false;
+}
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        RunSoftEncoder
+// Description: Replays a random quadrature stream into SIM_REPLAY_ENCODERS software encoders
+// Arguments:   Edges - Number of edges
+//              Result - sim_replay_t struct to receive the results
+// Returns:     True if the test ran, false if the encoders could not be added
+
+bool SimReplay::RunSoftEncoder(uint32_t Edges, sim_replay_t *Result)
+{
+    if (Result == nullptr)
+        return false;
+
+#if defined(__unix__) || defined(__APPLE__)
+    // Encoders share one port - Added once, later runs continue from their positions
+    if (_Ready == false)
+    {
+        soft_encoder_config_t Config = {};
+        Config.Hardware.PeriphGPIO = SYSCTL_PERIPH_GPIOA;
+        Config.Hardware.BaseGPIO = GPIO_PORTA_BASE;
+        Config.Params.PPR = 1999;
+        Config.Params.ScanFreq = 1000;
+
+        for (uint8_t Index = 0; Index < SIM_REPLAY_ENCODERS; Index++)
+        {
+            Config.Hardware.PinA = 1UL << (2 * Index);
+            Config.Hardware.PinB = 1UL << (2 * Index + 1);
+
+            if (!_Encoders[Index].Init(&Config))
+                return false;
+        }
+
+        _Ready = true;
+    }
+
+    int64_t Start[SIM_REPLAY_ENCODERS];
+    int64_t Steps[SIM_REPLAY_ENCODERS] = {};
+    uint32_t Errors = 0;
+
+    for (uint8_t Index = 0; Index < SIM_REPLAY_ENCODERS; Index++)
+    {
+        _Encoders[Index].Scan();
+        Start[Index] = _Encoders[Index].GetPosAbs();
+        Errors -= _Encoders[Index].GetErrors();
+    }
+
+    // Record the stream - One step of one encoder per edge, odd encoders biased forward
+    std::vector<uint8_t> Stream(Edges);
+    uint8_t Value = _PortValue;
+
+    for (uint32_t Edge = 0; Edge < Edges; Edge++)
+    {
+        _Seed = _Seed * 1103515245UL + 12345UL;
+
+        uint8_t Index = (uint8_t)((_Seed >> 16) % SIM_REPLAY_ENCODERS);
+        int8_t Dir = (((_Seed >> 8) & 7) < (uint32_t)(4 + (Index & 1))) ? 1 : -1;
+
+        _Phase[Index] = (uint8_t)((_Phase[Index] + Dir) & 3);
+        Steps[Index] += Dir;
+
+        uint8_t Shift = (uint8_t)(2 * Index);
+        uint8_t State = _Sequence[_Phase[Index]];
+
+        // Pin A at bit 2N, pin B at bit 2N + 1
+        Value = (uint8_t)((Value & ~(3U << Shift)) | (((State >> 1) & 1) << Shift) | ((State & 1) << (Shift + 1)));
+        Stream[Edge] = Value;
+    }
+
+    // Replay - One port interrupt per edge
+    uint64_t Begin = SimHarness::Nanoseconds();
+
+    for (uint32_t Edge = 0; Edge < Edges; Edge++)
+    {
+        _PortValue = Stream[Edge];
+        _PortHandler();
+    }
+
+    uint64_t Elapsed = SimHarness::Nanoseconds() - Begin;
+
+    Result->Edges = Edges;
+    Result->NsPerEdge = (Edges > 0) ? (float)Elapsed / Edges : 0;
+    Result->Mismatches = 0;
+
+    for (uint8_t Index = 0; Index < SIM_REPLAY_ENCODERS; Index++)
+    {
+        _Encoders[Index].Scan();
+
+        if ((_Encoders[Index].GetPosAbs() - Start[Index]) != Steps[Index])
+            Result->Mismatches++;
+
+        Errors += _Encoders[Index].GetErrors();
+    }
+
+    Result->Errors = Errors;
+
+    return true;
+#else
+    (void)Edges;
+    return false;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------------- //
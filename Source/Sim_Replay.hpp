@@ -0,0 +1,91 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Host edge-stream replay tests
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      This library replays recorded pin streams into the GPIO decoders on the host, next to the
+//      simulation harness. It provides a host model of the few driverlib GPIO, SysCtl and interrupt
+//      functions SoftEncoder uses: the port reads return the current stream value and the registered
+//      port handler is called once per stream value, as the edge interrupt would be. It is only built
+//      on hosts (unix or macOS); link it instead of driverlib.
+
+//      RunSoftEncoder records a stream for SIM_REPLAY_ENCODERS encoders on one port: every value
+//      moves one random encoder one quadrature step, forward or backward. The stream is recorded
+//      before the timed replay, so the time per edge is the port ISR alone (clear, one port read and
+//      one decode per encoder). The multi-turn position change of every encoder must match the
+//      recorded steps exactly, with no invalid transitions.
+
+//      Usage example:
+//          sim_replay_t Result;
+//          SimReplay::RunSoftEncoder(20000000, &Result);   // Pass if Mismatches and Errors are 0
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef SIM_REPLAY_H_
+#define SIM_REPLAY_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#define SIM_REPLAY_ENCODERS 4           // Encoders on the replayed port (pins 2N and 2N + 1)
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// Replay results
+typedef struct
+{
+    uint32_t Edges;                 // Number of replayed edges
+    float NsPerEdge;                // Time per edge (ns), 0 if no clock is available
+    uint8_t Mismatches;             // Encoders whose position change differs from the stream
+    uint32_t Errors;                // Invalid transitions counted by the encoders
+} sim_replay_t;
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+class SimReplay
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        RunSoftEncoder
+        // Description: Replays a random quadrature stream into SIM_REPLAY_ENCODERS software encoders
+        // Arguments:   Edges - Number of edges
+        //              Result - sim_replay_t struct to receive the results
+        // Returns:     True if the test ran, false if the encoders could not be added
+        static bool RunSoftEncoder(uint32_t Edges, sim_replay_t *Result);
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
@@ -0,0 +1,148 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Host concurrency stress tests
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Stress tests defines and macros
+#include "Sim_Stress.hpp"
+
+// Standard libraries
+#include <stdint.h>
+
+// Sequence lock
+#include "Seqlock_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Threaded host - x86 only: SEQLOCK_BARRIER orders nothing at run time, and weakly ordered cores
+// (arm64 hosts, including macOS) may reorder the copy with the sequence loads across cores
+#if (defined(__unix__) || defined(__APPLE__)) && (defined(__x86_64__) || defined(__i386__))
+#define SIM_STRESS_HOST 1
+#else
+#define SIM_STRESS_HOST 0
+#endif
+
+// Host threads
+#if SIM_STRESS_HOST
+#include <atomic>
+#include <thread>
+#endif
+
+#if SIM_STRESS_HOST
+
+// ------------------------------------------------------------------------------------------------------- //
+// Static variables
+// ------------------------------------------------------------------------------------------------------- //
+
+static Seqlock<sim_stress_record_t> _Shared;    // Seqlock under test
+static std::atomic<bool> _Stop;                 // Set by the writer when done
+
+// ------------------------------------------------------------------------------------------------------- //
+// Static functions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _Writer
+// Description: Writer thread - Publishes records 1 to Writes
+// Arguments:   Writes - Number of writes
+// Returns:     None
+
+static void _Writer(uint32_t Writes)
+{
+    sim_stress_record_t Record;
+
+    for (uint32_t Seq = 1; Seq <= Writes; Seq++)
+    {
+        Record.Seq = Seq;
+        Record.Inv = ~Seq;
+        Record.Wide = -3 * (int64_t)Seq;
+        Record.Value = (float)(Seq & 0xFFFF);
+
+        _Shared.Write(Record);
+    }
+
+    _Stop = true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _Reader
+// Description: Reader thread - Copies records until the writer is done and checks each copy
+// Arguments:   Result - sim_stress_t struct to receive the counts of this reader
+// Returns:     None
+
+static void _Reader(sim_stress_t *Result)
+{
+    sim_stress_record_t Record;
+
+    while (!_Stop)
+    {
+        Result->Retries += _Shared.Read(&Record);
+        Result->Reads++;
+
+        if ((Record.Inv != ~Record.Seq) || (Record.Wide != -3 * (int64_t)Record.Seq) ||
+            (Record.Value != (float)(Record.Seq & 0xFFFF)))
+            Result->Torn++;
+    }
+}
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        RunSeqlock
+// Description: Runs one writer and several reader threads on a Seqlock
+// Arguments:   Writes - Number of writes
+//              Readers - Number of reader threads (1 to SIM_STRESS_MAX_READERS)
+//              Result - sim_stress_t struct to receive the results
+// Returns:     True if the test ran, false if the arguments are invalid or the host is not x86
+
+bool SimStress::RunSeqlock(uint32_t Writes, uint8_t Readers, sim_stress_t *Result)
+{
+    if ((Result == nullptr) || (Readers == 0) || (Readers > SIM_STRESS_MAX_READERS))
+        return false;
+
+#if SIM_STRESS_HOST
+    sim_stress_t Counts[SIM_STRESS_MAX_READERS] = {};
+    std::thread Threads[SIM_STRESS_MAX_READERS];
+
+    // Record 0 is consistent - Readers may copy it before the first write
+    _Shared.Write(sim_stress_record_t{0, ~0U, 0, 0});
+    _Stop = false;
+
+    for (uint8_t Index = 0; Index < Readers; Index++)
+        Threads[Index] = std::thread(_Reader, &Counts[Index]);
+
+    _Writer(Writes);
+
+    *Result = sim_stress_t{Writes, 0, 0, 0};
+
+    for (uint8_t Index = 0; Index < Readers; Index++)
+    {
+        Threads[Index].join();
+
+        Result->Reads += Counts[Index].Reads;
+        Result->Retries += Counts[Index].Retries;
+        Result->Torn += Counts[Index].Torn;
+    }
+
+    return true;
+#else
+    (void)Writes;
+    return false;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------------- //
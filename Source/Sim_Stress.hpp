@@ -0,0 +1,105 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Host concurrency stress tests
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      This library checks the lock-free primitives with real threads on the host, next to the
+//      simulation harness. It only runs on x86 hosts with threads (unix or macOS); elsewhere, the
+//      target included, every test returns false without doing anything.
+
+//      RunSeqlock runs one writer thread publishing sim_stress_record_t snapshots through a
+//      Seqlock<sim_stress_record_t> and several reader threads copying them with Read. Every field
+//      of a record is derived from its sequence number, so a copy mixing two writes is detected and
+//      counted as torn. A correct Seqlock gives 0 torn reads; the retry count shows how often the
+//      writer overlapped a copy.
+
+//      Unlike the writer ISR and the main loop on the target, the threads may run on separate cores.
+//      The compiler barrier of Seqlock is still enough on x86, whose stores and loads are not
+//      reordered with other stores and loads. Weakly ordered hosts (arm64, Apple silicon included)
+//      would need hardware fences the single-core target does not, and would report torn reads the
+//      target can not produce, so the test is not built there.
+
+//      Usage example:
+//          sim_stress_t Result;
+//          SimStress::RunSeqlock(50000000, 3, &Result);      // Pass if Result.Torn == 0
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef SIM_STRESS_H_
+#define SIM_STRESS_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#define SIM_STRESS_MAX_READERS 8        // Maximum number of reader threads
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// Stress test record - Every field is derived from Seq
+typedef struct
+{
+    uint32_t Seq;                   // Sequence number of the write
+    uint32_t Inv;                   // ~Seq
+    int64_t Wide;                   // -3 * Seq (64-bit, two words on the target)
+    float Value;                    // Seq & 0xFFFF
+} sim_stress_record_t;
+
+// Stress test results
+typedef struct
+{
+    uint32_t Writes;                // Number of writes
+    uint64_t Reads;                 // Number of reads (all readers)
+    uint64_t Retries;               // Number of read retries (all readers)
+    uint64_t Torn;                  // Number of inconsistent copies (must be 0)
+} sim_stress_t;
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+class SimStress
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        RunSeqlock
+        // Description: Runs one writer and several reader threads on a Seqlock
+        // Arguments:   Writes - Number of writes
+        //              Readers - Number of reader threads (1 to SIM_STRESS_MAX_READERS)
+        //              Result - sim_stress_t struct to receive the results
+        // Returns:     True if the test ran, false if the arguments are invalid or the host is not x86
+        static bool RunSeqlock(uint32_t Writes, uint8_t Readers, sim_stress_t *Result);
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
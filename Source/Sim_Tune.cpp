@@ -0,0 +1,86 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Host autotune experiments
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Autotune experiments defines and macros
+#include "Sim_Tune.hpp"
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        RunFopdt
+// Description: Runs the relay autotune against a FOPDT plant, then the tuned loop
+// Arguments:   Controller - Configured controller (reference, limits, mode, sample time)
+//              Model - Initialized FOPDT plant
+//              Bias - Relay output center
+//              Amplitude - Relay amplitude
+//              Hysteresis - Relay hysteresis (error units)
+//              Rule - Tuning rule
+//              Steps - Sample limit of the experiment and length of the tuned-loop run
+//              Ts - Sample time (s)
+//              Result - sim_tune_t struct to receive the results
+// Returns:     True if the experiment found the gains, false otherwise
+
+bool SimTune::RunFopdt(Pid *Controller, PlantFopdt *Model, float Bias, float Amplitude, float Hysteresis,
+                       pid_tune_rule_t Rule, uint32_t Steps, float Ts, sim_tune_t *Result)
+{
+    if ((Controller == nullptr) || (Model == nullptr) || (Result == nullptr))
+        return false;
+
+    Result->Samples = 0;
+    Result->Loop = {};
+
+    // Relay experiment - One sample per Compute call
+    Model->Reset();
+    Controller->StartAutotune(Bias, Amplitude, Hysteresis, Rule, SIM_TUNE_CYCLES, Steps);
+
+    float Y = 0;
+
+    while ((Controller->GetAutotuneState() == PID_TUNE_RUNNING) && (Result->Samples < Steps))
+    {
+        Y = Model->Step(Controller->Compute(Y));
+        Result->Samples++;
+    }
+
+    float Buffer[3];
+
+    Controller->GetAutotuneResult(Buffer);
+    Result->Ku = Buffer[0];
+    Result->Pu = Buffer[1] * Ts;
+
+    Controller->GetGains(Buffer);
+    Result->Kp = Buffer[0];
+    Result->Ki = Buffer[1];
+    Result->Kd = Buffer[2];
+
+    Result->State = Controller->GetAutotuneState();
+
+    if (Result->State != PID_TUNE_DONE)
+    {
+        Controller->StopAutotune();
+        return false;
+    }
+
+    // Tuned loop - Step from rest to the current reference (Reset would clear the gains)
+    Model->Reset();
+    Controller->Preset(0, 0);
+    SimHarness::Run(Controller, Model, Steps, Ts, &Result->Loop);
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
@@ -0,0 +1,116 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Host autotune experiments
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      This library runs the Pid relay autotune on the host against the first order plus dead time
+//      model of Sim_Plants.hpp, next to the simulation harness, and reports what the experiment found
+//      and how well the tuned loop performs.
+
+//      RunFopdt drives the relay experiment (Pid::StartAutotune) on a PlantFopdt until it is done,
+//      failed or out of samples, and reads Ku, Pu and the gains written by the tuning rule. With the
+//      experiment done, the plant is reset, the controller is preset to a zero output and the tuned loop is run with
+//      SimHarness::Run against the current reference: rise time, overshoot and IAE of the step.
+
+//      The controller is configured by the caller (reference, limits, mode, sample time) and keeps
+//      the tuned gains after the run.
+
+//      Usage example:
+//          Pid Controller(1.0f, 0, 0, 1.0f, -2.0f, 2.0f);
+//          PlantFopdt Model;
+//          sim_tune_t Result;
+//          Model.Init(1.0f, 0.5f, 50, 0.001f);
+//          SimTune::RunFopdt(&Controller, &Model, 1.0f, 0.5f, 0.01f, PID_TUNE_ZIEGLER_NICHOLS,
+//                            100000, 0.001f, &Result);
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef SIM_TUNE_H_
+#define SIM_TUNE_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// PID controller
+#include "Pid_TivaC.hpp"
+
+// Plant models
+#include "Sim_Plants.hpp"
+
+// Simulation harness
+#include "Sim_Harness.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#define SIM_TUNE_CYCLES 4               // Relay cycles averaged by the experiment
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// Autotune experiment results
+typedef struct
+{
+    pid_tune_state_t State;         // Autotune state at the end of the experiment
+    uint32_t Samples;               // Samples taken by the relay experiment
+    float Ku;                       // Ultimate gain
+    float Pu;                       // Ultimate period (s)
+    float Kp;                       // Tuned proportional gain
+    float Ki;                       // Tuned integral gain (units of the controller mode)
+    float Kd;                       // Tuned derivative gain (units of the controller mode)
+    sim_result_t Loop;              // Step response of the tuned loop (zeros if the experiment failed)
+} sim_tune_t;
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+class SimTune
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        RunFopdt
+        // Description: Runs the relay autotune against a FOPDT plant, then the tuned loop
+        // Arguments:   Controller - Configured controller (reference, limits, mode, sample time)
+        //              Model - Initialized FOPDT plant
+        //              Bias - Relay output center
+        //              Amplitude - Relay amplitude
+        //              Hysteresis - Relay hysteresis (error units)
+        //              Rule - Tuning rule
+        //              Steps - Sample limit of the experiment and length of the tuned-loop run
+        //              Ts - Sample time (s)
+        //              Result - sim_tune_t struct to receive the results
+        // Returns:     True if the experiment found the gains, false otherwise
+        static bool RunFopdt(Pid *Controller, PlantFopdt *Model, float Bias, float Amplitude, float Hysteresis,
+                             pid_tune_rule_t Rule, uint32_t Steps, float Ts, sim_tune_t *Result);
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
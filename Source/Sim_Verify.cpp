@@ -0,0 +1,262 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Host numerical verification
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Verification defines and macros
+#include "Sim_Verify.hpp"
+
+// Standard libraries
+#include <stdint.h>
+#include <math.h>
+
+// DARE solver
+#include "Dare_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Static variables
+// ------------------------------------------------------------------------------------------------------- //
+
+static uint32_t _Seed = 1;                      // Random generator state
+
+// ------------------------------------------------------------------------------------------------------- //
+// Static functions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _Uniform
+// Description: Draws a uniform random number
+// Arguments:   Min - Lower bound
+//              Max - Upper bound
+// Returns:     Random number in [Min, Max)
+
+static float _Uniform(float Min, float Max)
+{
+    _Seed = _Seed * 1103515245UL + 12345UL;
+
+    return Min + (Max - Min) * (float)((_Seed >> 8) & 0xFFFFFF) / 16777216.0f;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _Riccati
+// Description: Runs the plain Riccati recursion in double precision until P stops changing
+// Arguments:   A - State matrix (Size x Size, row-major)
+//              B - Input vector
+//              Q - State weight (Size x Size, row-major)
+//              R - Input weight
+//              Size - Number of states
+//              K - Buffer to receive the gain (Size values)
+// Returns:     True if the recursion converged, false otherwise
+
+static bool _Riccati(const float *A, const float *B, const float *Q, float R, uint8_t Size, double *K)
+{
+    double P[MAX_DARE_STATES][MAX_DARE_STATES];
+    double Next[MAX_DARE_STATES][MAX_DARE_STATES];
+    double PA[MAX_DARE_STATES][MAX_DARE_STATES];
+    double BPA[MAX_DARE_STATES];
+
+    for (uint8_t Row = 0; Row < Size; Row++)
+        for (uint8_t Col = 0; Col < Size; Col++)
+            P[Row][Col] = Q[Row * Size + Col];
+
+    for (uint32_t Iteration = 0; Iteration < SIM_VERIFY_REF_ITERATIONS; Iteration++)
+    {
+        // PA = P A, BPA = B' P A, Den = R + B' P B
+        double Den = R;
+
+        for (uint8_t Row = 0; Row < Size; Row++)
+        {
+            for (uint8_t Col = 0; Col < Size; Col++)
+            {
+                double Sum = 0;
+
+                for (uint8_t Idx = 0; Idx < Size; Idx++)
+                    Sum += P[Row][Idx] * A[Idx * Size + Col];
+
+                PA[Row][Col] = Sum;
+            }
+
+            for (uint8_t Col = 0; Col < Size; Col++)
+                Den += B[Row] * P[Row][Col] * B[Col];
+        }
+
+        for (uint8_t Col = 0; Col < Size; Col++)
+        {
+            double Sum = 0;
+
+            for (uint8_t Idx = 0; Idx < Size; Idx++)
+                Sum += B[Idx] * PA[Idx][Col];
+
+            BPA[Col] = Sum;
+        }
+
+        // Next = Q + A' P A - (B' P A)' (B' P A) / Den
+        double Delta = 0;
+        double Scale = 0;
+
+        for (uint8_t Row = 0; Row < Size; Row++)
+        {
+            for (uint8_t Col = 0; Col < Size; Col++)
+            {
+                double Sum = Q[Row * Size + Col] - BPA[Row] * BPA[Col] / Den;
+
+                for (uint8_t Idx = 0; Idx < Size; Idx++)
+                    Sum += A[Idx * Size + Row] * PA[Idx][Col];
+
+                Next[Row][Col] = Sum;
+
+                if (fabs(Sum - P[Row][Col]) > Delta)
+                    Delta = fabs(Sum - P[Row][Col]);
+
+                if (fabs(Sum) > Scale)
+                    Scale = fabs(Sum);
+            }
+        }
+
+        // Non-finite - Not stabilizable
+        if (!(Scale < 1e30))
+            return false;
+
+        for (uint8_t Row = 0; Row < Size; Row++)
+            for (uint8_t Col = 0; Col < Size; Col++)
+                P[Row][Col] = Next[Row][Col];
+
+        if (Delta <= 1e-14 * Scale)
+        {
+            for (uint8_t Col = 0; Col < Size; Col++)
+                K[Col] = BPA[Col] / Den;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        RunDare
+// Description: Compares the Dare gain with a double-precision Riccati recursion on random systems
+// Arguments:   Systems - Number of systems
+//              Size - Number of states (1 to MAX_DARE_STATES)
+//              Seed - Random generator seed
+//              Result - sim_verify_dare_t struct to receive the results
+// Returns:     True if the test ran, false if the arguments are invalid
+
+bool SimVerify::RunDare(uint16_t Systems, uint8_t Size, uint32_t Seed, sim_verify_dare_t *Result)
+{
+    if ((Result == nullptr) || (Size == 0) || (Size > MAX_DARE_STATES))
+        return false;
+
+    float A[MAX_DARE_STATES * MAX_DARE_STATES];
+    float B[MAX_DARE_STATES];
+    float M[MAX_DARE_STATES * MAX_DARE_STATES];
+    float Q[MAX_DARE_STATES * MAX_DARE_STATES];
+    float K[MAX_DARE_STATES];
+    double Reference[MAX_DARE_STATES];
+    double ErrorSum = 0;
+
+    Dare Solver;
+
+    _Seed = Seed;
+
+    Result->Systems = 0;
+    Result->Failed = 0;
+    Result->Iterations = 0;
+    Result->MaxError = 0;
+    Result->MeanError = 0;
+
+    while (Result->Systems < Systems)
+    {
+        float Range = 1.5f / sqrtf((float)Size);
+
+        for (uint8_t Idx = 0; Idx < Size * Size; Idx++)
+        {
+            A[Idx] = _Uniform(-Range, Range);
+            M[Idx] = _Uniform(-1.0f, 1.0f);
+        }
+
+        for (uint8_t Idx = 0; Idx < Size; Idx++)
+            B[Idx] = _Uniform(-1.0f, 1.0f);
+
+        // Q = M M' + 0.1 I
+        for (uint8_t Row = 0; Row < Size; Row++)
+        {
+            for (uint8_t Col = 0; Col < Size; Col++)
+            {
+                float Sum = (Row == Col) ? 0.1f : 0.0f;
+
+                for (uint8_t Idx = 0; Idx < Size; Idx++)
+                    Sum += M[Row * Size + Idx] * M[Col * Size + Idx];
+
+                Q[Row * Size + Col] = Sum;
+            }
+        }
+
+        float R = powf(10.0f, _Uniform(-1.0f, 1.0f));
+
+        // Reference not converged - Draw again
+        if (!_Riccati(A, B, Q, R, Size, Reference))
+            continue;
+
+        Result->Systems++;
+
+        if (!Solver.Init(A, B, Q, R, Size, SIM_VERIFY_DARE_ITERATIONS, SIM_VERIFY_DARE_TOLERANCE))
+        {
+            Result->Failed++;
+            continue;
+        }
+
+        while (Solver.Step() == DARE_RUNNING);
+
+        if (Solver.GetState() != DARE_DONE)
+        {
+            Result->Failed++;
+            continue;
+        }
+
+        if (Solver.GetIterations() > Result->Iterations)
+            Result->Iterations = Solver.GetIterations();
+
+        Solver.GetGains(K);
+
+        // Error relative to the largest reference gain
+        double Largest = 0;
+        double Error = 0;
+
+        for (uint8_t Idx = 0; Idx < Size; Idx++)
+        {
+            if (fabs(Reference[Idx]) > Largest)
+                Largest = fabs(Reference[Idx]);
+
+            if (fabs(K[Idx] - Reference[Idx]) > Error)
+                Error = fabs(K[Idx] - Reference[Idx]);
+        }
+
+        if (Largest > 0)
+            Error /= Largest;
+
+        if (Error > Result->MaxError)
+            Result->MaxError = (float)Error;
+
+        ErrorSum += Error;
+    }
+
+    if (Result->Systems > Result->Failed)
+        Result->MeanError = (float)(ErrorSum / (Result->Systems - Result->Failed));
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
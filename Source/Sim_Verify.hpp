@@ -0,0 +1,105 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Host numerical verification
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      This library checks the single-precision solvers against double-precision references on the
+//      host, next to the simulation harness.
+
+//      RunDare draws random single-input systems (A, B, Q, R), solves each one with Dare::Step and
+//      compares the gain with the one of the plain Riccati recursion run in double precision until it
+//      stops changing:
+//          P <- Q + A' P A - A' P B (R + B' P B)^-1 B' P A
+//          K = (R + B' P B)^-1 B' P A
+//      The error of a system is the largest gain difference relative to the largest reference gain.
+//      Systems whose recursion does not converge (not stabilizable within the iteration limit) are
+//      drawn again and not counted.
+
+//      The random systems are:
+//          A   Uniform elements in [-1.5, 1.5] / sqrt(Size) (open-loop stable and unstable)
+//          B   Uniform elements in [-1, 1]
+//          Q   M M' + 0.1 I, M uniform in [-1, 1] (positive definite)
+//          R   10^u, u uniform in [-1, 1]
+
+//      Dare_TivaC.cpp calls IntMasterDisable / IntMasterEnable in Apply; on the host link it with the
+//      device model of Sim_Replay.cpp.
+
+//      Usage example:
+//          sim_verify_dare_t Result;
+//          SimVerify::RunDare(300, 4, 1, &Result);     // Mean error ~2e-6, worst ~4e-4 (ill-conditioned)
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef SIM_VERIFY_H_
+#define SIM_VERIFY_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#define SIM_VERIFY_DARE_ITERATIONS 60   // Iteration limit of Dare
+#define SIM_VERIFY_DARE_TOLERANCE 1e-6f // Relative convergence tolerance of Dare
+#define SIM_VERIFY_REF_ITERATIONS 200000 // Iteration limit of the double-precision recursion
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// DARE verification results
+typedef struct
+{
+    uint16_t Systems;               // Number of compared systems
+    uint16_t Failed;                // Systems where Dare did not reach DARE_DONE
+    uint16_t Iterations;            // Largest number of Dare iterations
+    float MaxError;                 // Largest relative gain error
+    float MeanError;                // Mean relative gain error
+} sim_verify_dare_t;
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+class SimVerify
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        RunDare
+        // Description: Compares the Dare gain with a double-precision Riccati recursion on random systems
+        // Arguments:   Systems - Number of systems
+        //              Size - Number of states (1 to MAX_DARE_STATES)
+        //              Seed - Random generator seed
+        //              Result - sim_verify_dare_t struct to receive the results
+        // Returns:     True if the test ran, false if the arguments are invalid
+        static bool RunDare(uint16_t Systems, uint8_t Size, uint32_t Seed, sim_verify_dare_t *Result);
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
@@ -0,0 +1,349 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Software quadrature encoder library for TivaC devices
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Software encoder defines and macros
+#include "SoftEncoder_TivaC.hpp"
+
+// Standard libraries
+#include <stdint.h>
+
+// TivaC device defines and macros
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Initialize the static arrays and counter
+// ------------------------------------------------------------------------------------------------------- //
+
+soft_encoder_port_t SoftEncoder::_Ports[MAX_SOFT_ENCODER_PORTS] = {};
+uint8_t SoftEncoder::_InstanceCounter = 0;
+
+// Port interrupt handlers - Same order as _Ports
+void (* const SoftEncoder::_Handlers[MAX_SOFT_ENCODER_PORTS])() =
+{
+    SoftEncoder::_IsrPort0,
+    SoftEncoder::_IsrPort1,
+    SoftEncoder::_IsrPort2,
+    SoftEncoder::_IsrPort3,
+};
+
+// Transition table - Forward: 00 -> 10 -> 11 -> 01 -> 00 (A leads B)
+const int8_t SoftEncoder::_Table[16] =
+{
+//  New:  00  01  10  11        Previous
+           0, -1, +1,  0,       // 00
+          +1,  0,  0, -1,       // 01
+          -1,  0,  0, +1,       // 10
+           0, +1, -1,  0,       // 11
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _InitHardware
+// Description: Starts device peripherals
+// Arguments:   None
+// Returns:     None
+
+void SoftEncoder::_InitHardware()
+{
+    uint32_t Pins = _Config.Hardware.PinA | _Config.Hardware.PinB;
+
+    // Enable peripheral clock
+    SysCtlPeripheralEnable (_Config.Hardware.PeriphGPIO);
+
+    // Wait until peripheral is ready
+    while(!SysCtlPeripheralReady (_Config.Hardware.PeriphGPIO));
+
+    // Unlock used pins (has no effect if pin is not protected by the GPIOCR register
+    GPIOUnlockPin(_Config.Hardware.BaseGPIO, Pins);
+
+    // Configure pins as inputs
+    GPIOPinTypeGPIOInput(_Config.Hardware.BaseGPIO, Pins);
+    GPIOPadConfigSet(_Config.Hardware.BaseGPIO, Pins, GPIO_STRENGTH_2MA, _Config.Hardware.PadType);
+
+    // Interrupt on every edge of both pins
+    GPIOIntTypeSet(_Config.Hardware.BaseGPIO, Pins, GPIO_BOTH_EDGES);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _IsrPort
+// Description: Port interrupt service routine - Decodes all encoders of one port
+// Arguments:   Port - Index of the port in _Ports
+// Returns:     None
+
+inline void SoftEncoder::_IsrPort(uint8_t Port)
+{
+    soft_encoder_port_t *Entry = &_Ports[Port];
+
+    // Clear before reading - An edge after the read interrupts again
+    GPIOIntClear(Entry->Base, Entry->Mask);
+
+    // One read for all encoders of the port
+    uint32_t Value = GPIOPinRead(Entry->Base, Entry->Mask);
+
+    for (uint8_t Index = 0; Index < Entry->Count; Index++)
+        Entry->Encoders[Index]->_Decode(Value);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        _IsrPortN
+// Description: Port interrupt handlers registered in the vector table - Call _IsrPort(N)
+// Arguments:   None
+// Returns:     None
+
+void SoftEncoder::_IsrPort0() { _IsrPort(0); }
+void SoftEncoder::_IsrPort1() { _IsrPort(1); }
+void SoftEncoder::_IsrPort2() { _IsrPort(2); }
+void SoftEncoder::_IsrPort3() { _IsrPort(3); }
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SoftEncoder
+// Description: Constructor of the class with no arguments
+// Arguments:   None
+// Returns:     None
+
+SoftEncoder::SoftEncoder()
+{
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SoftEncoder
+// Description: Constructor of the class with soft_encoder_config_t struct as argument
+// Arguments:   Config - soft_encoder_config_t struct
+// Returns:     None
+
+SoftEncoder::SoftEncoder(const soft_encoder_config_t *Config)
+{
+    Init(Config);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Init
+// Description: Starts device peripherals and adds the encoder to the port handler
+// Arguments:   Config - soft_encoder_config_t struct
+// Returns:     True if the encoder was added, false if the instance or port limit was reached
+
+bool SoftEncoder::Init(const soft_encoder_config_t *Config)
+{
+    if (_InstanceCounter >= MAX_SOFT_ENCODERS)
+        return false;
+
+    // Port entry - Existing one or first free one
+    uint8_t Port = 0;
+
+    while ((Port < MAX_SOFT_ENCODER_PORTS) && (_Ports[Port].Base != 0) &&
+           (_Ports[Port].Base != Config->Hardware.BaseGPIO))
+        Port++;
+
+    if (Port == MAX_SOFT_ENCODER_PORTS)
+        return false;
+
+    // Copy config to a private variable
+    _Config = *Config;
+
+    // Pin masks to bit positions
+    _ShiftA = 0;
+    _ShiftB = 0;
+
+    while ((_Config.Hardware.PinA >> _ShiftA) > 1)
+        _ShiftA++;
+
+    while ((_Config.Hardware.PinB >> _ShiftB) > 1)
+        _ShiftB++;
+
+    //  Initialize hardware
+    _InitHardware();
+
+    soft_encoder_port_t *Entry = &_Ports[Port];
+
+    // The port handler must not run while its list changes
+    if (Entry->Base != 0)
+        GPIOIntDisable(Entry->Base, Entry->Mask);
+
+    // Initial state - The first edge is decoded against it
+    _Decode(GPIOPinRead(_Config.Hardware.BaseGPIO, _Config.Hardware.PinA | _Config.Hardware.PinB));
+    _Count = 0;
+    _Count_lst = 0;
+    _Errors = 0;
+
+    Entry->Base = _Config.Hardware.BaseGPIO;
+    Entry->Mask |= _Config.Hardware.PinA | _Config.Hardware.PinB;
+    Entry->Encoders[Entry->Count++] = this;
+    _InstanceCounter++;
+
+    // Register interrupt handler for the port and enable all its encoder pins
+    GPIOIntRegister(Entry->Base, _Handlers[Port]);
+    GPIOIntClear(Entry->Base, Entry->Mask);
+    GPIOIntEnable(Entry->Base, Entry->Mask);
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Scan
+// Description: Updates position, velocity and direction (call every 1 / ScanFreq s)
+// Arguments:   None
+// Returns:     None
+
+void SoftEncoder::Scan ()
+{
+    // Modular difference - Correct across the wrap around of the count
+    uint32_t Count = _Count;
+    int32_t Delta = (int32_t)(Count - _Count_lst);
+    int64_t Range = (int64_t)_Config.Params.PPR + 1;
+
+    _Count_lst = Count;
+
+    // Direction of the last movement
+    if (Delta > 0)
+        _Data.Dir = 1;
+
+    else if (Delta < 0)
+        _Data.Dir = -1;
+
+    _Data.Vel = (uint32_t)((Delta < 0) ? -Delta : Delta);
+    _Data.Speed = (float)Delta * (float)_Config.Params.ScanFreq;
+
+    // Multi-turn position - Position in [0, PPR] as the QEI
+    _Data.PosAbs += Delta;
+
+    int64_t Turns = _Data.PosAbs / Range;
+
+    if ((Turns * Range) > _Data.PosAbs)
+        Turns--;
+
+    _Data.Turns = (int32_t)Turns;
+    _Data.Pos = (uint32_t)(_Data.PosAbs - Turns * Range);
+
+    // Publish the scan to the readers
+    _Shared.Write(_Data);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetData
+// Description: Gets all encoder data from the same scan (retries while Scan overlaps the copy)
+// Arguments:   Buffer - encoder_data_t struct to receive data
+// Returns:     None
+
+void SoftEncoder::GetData (encoder_data_t *Buffer)
+{
+    if (Buffer != nullptr)
+        _Shared.Read(Buffer);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetPos
+// Description: Gets encoder position
+// Arguments:   None
+// Returns:     Encoder position computed in last scan
+
+uint32_t SoftEncoder::GetPos ()
+{
+    return _Data.Pos;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        SetPos
+// Description: Sets encoder position (the revolution counter is kept)
+// Arguments:   New encoder position
+// Returns:     None
+
+void SoftEncoder::SetPos (uint32_t Pos)
+{
+    // Scan runs in a timer ISR chosen by the application - Mask all interrupts
+    bool Masked = IntMasterDisable();
+
+    _Data.Pos = Pos;
+    _Data.PosAbs = (int64_t)_Data.Turns * ((int64_t)_Config.Params.PPR + 1) + Pos;
+
+    _Shared.Write(_Data);
+
+    if (!Masked)
+        IntMasterEnable();
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetVel
+// Description: Gets encoder velocity
+// Arguments:   None
+// Returns:     Encoder velocity computed in last scan (pulses per ScanFreq period)
+
+uint32_t SoftEncoder::GetVel ()
+{
+    return _Data.Vel;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetDir
+// Description: Gets encoder direction
+// Arguments:   None
+// Returns:     Encoder direction computed in last scan
+
+int32_t SoftEncoder::GetDir ()
+{
+    return _Data.Dir;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetSpeed
+// Description: Gets encoder speed
+// Arguments:   None
+// Returns:     Encoder speed computed in last scan (pulses/s, signed)
+
+float SoftEncoder::GetSpeed ()
+{
+    return _Data.Speed;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetPosAbs
+// Description: Gets encoder absolute position (tear-free)
+// Arguments:   None
+// Returns:     Encoder absolute position computed in last scan (pulses, multi-turn)
+
+int64_t SoftEncoder::GetPosAbs ()
+{
+    // 64-bit reads are not atomic - Read through the snapshot
+    return _Shared.ReadField(&encoder_data_t::PosAbs);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetErrors
+// Description: Gets the number of invalid transitions (missed edges)
+// Arguments:   None
+// Returns:     Number of invalid transitions
+
+uint32_t SoftEncoder::GetErrors ()
+{
+    return _Errors;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
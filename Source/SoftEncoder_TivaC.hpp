@@ -0,0 +1,267 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Software quadrature encoder library for TivaC devices
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      SoftEncoder decodes quadrature signals on any two GPIO pins, for axes beyond the two QEI
+//      modules of the TM4C. Both pins interrupt on both edges and every edge is decoded x4 with a
+//      16-entry transition table indexed by (previous state << 2) | new state, state = (A << 1) | B:
+//          +1 forward step, -1 backward step, 0 no change or invalid (both pins changed)
+//      Invalid transitions mean edges were missed and are counted (see GetErrors).
+
+//      Encoders are grouped by GPIO port. Each port has its own interrupt handler, reached directly
+//      from the vector table through a handler table (no search), which reads the port once and
+//      decodes every encoder on that port from that single read (two table lookups per encoder, no
+//      branches).
+
+//      Scan must be called every 1 / ScanFreq s (e.g. from a timer ISR). It turns the edge count into
+//      the same data as Encoder: position, pulses per ScanFreq period, direction, speed and
+//      multi-turn position. GetData reads it through a Seqlock snapshot.
+
+//      Usage example:
+//          SoftEncoder Axis(&Config);      // Pins PB0 (A) and PB1 (B)
+//          ...
+//          Axis.Scan();                    // Timer ISR at ScanFreq
+//          ...
+//          uint32_t Pos = Axis.GetPos();
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef SOFTENCODER_TIVAC_H_
+#define SOFTENCODER_TIVAC_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// Encoder parameters and data
+#include "Encoder_TivaC.hpp"
+
+// Sequence lock
+#include "Seqlock_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#define MAX_SOFT_ENCODERS 8         // Maximum number of software encoder instances
+#define MAX_SOFT_ENCODER_PORTS 4    // Maximum number of GPIO ports with software encoders
+
+// Invalid transitions (both pins changed) - Bit N set if table entry N is invalid
+#define SOFT_ENCODER_INVALID 0x1248
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// Hardware configuration structure
+typedef struct
+{
+    uint32_t PeriphGPIO;            // GPIO peripheral
+    uint32_t BaseGPIO;              // GPIO base
+    uint32_t PinA;                  // GPIO pin A
+    uint32_t PinB;                  // GPIO pin B
+    uint32_t PadType;               // GPIO pad type (e.g. GPIO_PIN_TYPE_STD_WPU for open collector outputs)
+} soft_encoder_hardware_t;
+
+// Software encoder configuration structure
+typedef struct
+{
+    soft_encoder_hardware_t Hardware;   // Hardware struct
+    encoder_params_t Params;            // Parameters struct
+} soft_encoder_config_t;
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+class SoftEncoder;
+
+// GPIO port with software encoders
+typedef struct
+{
+    uint32_t Base;                  // GPIO base (0 = free entry)
+    uint32_t Mask;                  // All encoder pins of the port
+    uint8_t Count;                  // Number of encoders on the port
+    SoftEncoder *Encoders[MAX_SOFT_ENCODERS];   // Encoders on the port
+} soft_encoder_port_t;
+
+class SoftEncoder
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        // Ports with software encoders
+        static soft_encoder_port_t _Ports[MAX_SOFT_ENCODER_PORTS];
+
+        // Port interrupt handlers - One per _Ports entry
+        static void (* const _Handlers[MAX_SOFT_ENCODER_PORTS])();
+
+        // Counter to keep track of the number of instances
+        static uint8_t _InstanceCounter;
+
+        // Transition table - Indexed by (previous state << 2) | new state
+        static const int8_t _Table[16];
+
+        // Software encoder configuration object
+        soft_encoder_config_t _Config;
+
+        // Decoder variables - Written by the port ISR only
+        volatile uint32_t _Count = 0;   // Edge count (pulses, wraps around - unsigned, no overflow)
+        volatile uint32_t _Errors = 0;  // Invalid transitions
+        uint8_t _State = 0;             // Last pin state - (A << 1) | B
+        uint8_t _ShiftA = 0;            // Bit of pin A in the port
+        uint8_t _ShiftB = 0;            // Bit of pin B in the port
+
+        // Scan variables - Written by Scan only
+        uint32_t _Count_lst = 0;        // Edge count of the last scan
+        encoder_data_t _Data = encoder_data_t_default;
+
+        // Encoder variables - Snapshot published at the end of every scan
+        Seqlock<encoder_data_t> _Shared;
+
+        // Name:        _InitHardware
+        // Description: Starts device peripherals
+        // Arguments:   None
+        // Returns:     None
+        void _InitHardware();
+
+        // Name:        _IsrPort
+        // Description: Port interrupt service routine - Decodes all encoders of one port
+        // Arguments:   Port - Index of the port in _Ports
+        // Returns:     None
+        static void _IsrPort(uint8_t Port);
+
+        // Name:        _IsrPortN
+        // Description: Port interrupt handlers registered in the vector table - Call _IsrPort(N)
+        // Arguments:   None
+        // Returns:     None
+        static void _IsrPort0();
+        static void _IsrPort1();
+        static void _IsrPort2();
+        static void _IsrPort3();
+
+        // Name:        _Decode
+        // Description: Decodes one port reading
+        // Arguments:   Value - Port reading
+        // Returns:     None
+        void _Decode(uint32_t Value);
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        SoftEncoder
+        // Description: Constructor of the class with no arguments
+        // Arguments:   None
+        // Returns:     None
+        SoftEncoder();
+
+        // Name:        SoftEncoder
+        // Description: Constructor of the class with soft_encoder_config_t struct as argument
+        // Arguments:   Config - soft_encoder_config_t struct
+        // Returns:     None
+        SoftEncoder(const soft_encoder_config_t *Config);
+
+        // Name:        Init
+        // Description: Starts device peripherals and adds the encoder to the port handler
+        // Arguments:   Config - soft_encoder_config_t struct
+        // Returns:     True if the encoder was added, false if the instance or port limit was reached
+        bool Init(const soft_encoder_config_t *Config);
+
+        // Name:        Scan
+        // Description: Updates position, velocity and direction (call every 1 / ScanFreq s)
+        // Arguments:   None
+        // Returns:     None
+        void Scan ();
+
+        // Name:        GetData
+        // Description: Gets all encoder data from the same scan (retries while Scan overlaps the copy)
+        // Arguments:   Buffer - encoder_data_t struct to receive data
+        // Returns:     None
+        void GetData (encoder_data_t *Buffer);
+
+        // Name:        GetPos
+        // Description: Gets encoder position
+        // Arguments:   None
+        // Returns:     Encoder position computed in last scan
+        uint32_t GetPos ();
+
+        // Name:        SetPos
+        // Description: Sets encoder position (the revolution counter is kept)
+        // Arguments:   New encoder position
+        // Returns:     None
+        void SetPos (uint32_t Pos);
+
+        // Name:        GetVel
+        // Description: Gets encoder velocity
+        // Arguments:   None
+        // Returns:     Encoder velocity computed in last scan (pulses per ScanFreq period)
+        uint32_t GetVel ();
+
+        // Name:        GetDir
+        // Description: Gets encoder direction
+        // Arguments:   None
+        // Returns:     Encoder direction computed in last scan
+        int32_t GetDir ();
+
+        // Name:        GetSpeed
+        // Description: Gets encoder speed
+        // Arguments:   None
+        // Returns:     Encoder speed computed in last scan (pulses/s, signed)
+        float GetSpeed ();
+
+        // Name:        GetPosAbs
+        // Description: Gets encoder absolute position (tear-free)
+        // Arguments:   None
+        // Returns:     Encoder absolute position computed in last scan (pulses, multi-turn)
+        int64_t GetPosAbs ();
+
+        // Name:        GetErrors
+        // Description: Gets the number of invalid transitions (missed edges)
+        // Arguments:   None
+        // Returns:     Number of invalid transitions
+        uint32_t GetErrors ();
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Inline functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+inline void SoftEncoder::_Decode(uint32_t Value)
+{
+    uint8_t State = (uint8_t)((((Value >> _ShiftA) & 1) << 1) | ((Value >> _ShiftB) & 1));
+    uint8_t Idx = (uint8_t)((_State << 2) | State);
+
+    _Count = _Count + (uint32_t)_Table[Idx];
+    _Errors = _Errors + ((SOFT_ENCODER_INVALID >> Idx) & 1);
+    _State = State;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
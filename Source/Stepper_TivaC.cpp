@@ -52,6 +52,9 @@
 // Standard libraries
 #include <stdint.h>
 
+// Execution time measurement
+#include "Wcet_TivaC.hpp"
+
 // Auxiliary functions
 #include <Aux_Functions.hpp>
 
@@ -411,6 +414,9 @@ void Stepper::_SetPwmFreq (uint32_t NewFreq)
 
 void Stepper::_CalculateVel ()
 {
+    // Execution time measurement
+    WCET_SCOPE(WCET_STEPPER_VEL);
+
     // Target reached
     if (_Status.CurrentVel == _Status.TargetVel)
     {
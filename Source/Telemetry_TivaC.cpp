@@ -0,0 +1,114 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Controller telemetry library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Telemetry defines and macros
+#include "Telemetry_TivaC.hpp"
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Static members
+// ------------------------------------------------------------------------------------------------------- //
+
+#if TELEMETRY_ENABLE
+SpscRing<telemetry_t, TELEMETRY_SIZE> Telemetry::_Rings[TELEMETRY_CHANNELS];
+uint8_t Telemetry::_Seq[TELEMETRY_CHANNELS] = {0};
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Drain
+// Description: Removes up to Max records from the rings, in channel order (consumer side - main loop)
+// Arguments:   Buffer - Buffer to receive the records
+//              Max - Buffer size (records)
+// Returns:     Number of records removed
+
+uint32_t Telemetry::Drain(telemetry_t *Buffer, uint32_t Max)
+{
+#if TELEMETRY_ENABLE
+    uint32_t Count = 0;
+
+    for (uint8_t Channel = 0; Channel < TELEMETRY_CHANNELS; Channel++)
+        Count += _Rings[Channel].Drain(Buffer + Count, Max - Count);
+
+    return Count;
+#else
+    (void)Buffer;
+    (void)Max;
+
+    return 0;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetCount
+// Description: Gets the number of records waiting in all rings
+// Arguments:   None
+// Returns:     Number of records
+
+uint32_t Telemetry::GetCount()
+{
+#if TELEMETRY_ENABLE
+    uint32_t Count = 0;
+
+    for (uint8_t Channel = 0; Channel < TELEMETRY_CHANNELS; Channel++)
+        Count += _Rings[Channel].GetCount();
+
+    return Count;
+#else
+    return 0;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetDropped
+// Description: Gets the number of records dropped because a ring was full
+// Arguments:   None
+// Returns:     Number of dropped records
+
+uint32_t Telemetry::GetDropped()
+{
+#if TELEMETRY_ENABLE
+    uint32_t Dropped = 0;
+
+    for (uint8_t Channel = 0; Channel < TELEMETRY_CHANNELS; Channel++)
+        Dropped += _Rings[Channel].GetDropped();
+
+    return Dropped;
+#else
+    return 0;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Clear
+// Description: Discards all records waiting in the rings (consumer side)
+// Arguments:   None
+// Returns:     None
+
+void Telemetry::Clear()
+{
+#if TELEMETRY_ENABLE
+    for (uint8_t Channel = 0; Channel < TELEMETRY_CHANNELS; Channel++)
+        _Rings[Channel].Clear();
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------------- //
@@ -0,0 +1,227 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Controller telemetry library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      Records the internals of Pid, Lead and Lqr at the full sample rate. Every call to Compute
+//      pushes one telemetry_t record into a wait-free SPSC ring (see Ring_TivaC.hpp) from the control
+//      ISR; the main loop drains the rings in bulk with Telemetry::Drain and sends the records out.
+
+//      The tap is a compile-time switch. Define TELEMETRY_ENABLE as 1 in the project options to
+//      enable it. With TELEMETRY_ENABLE = 0 (default) TELEMETRY_PUSH expands to nothing, so the
+//      controllers compile to exactly the same code as without telemetry, no ring is allocated and
+//      the drain API returns 0. When enabled, one push is an inline index check and a handful of
+//      stores, with no interrupt masking.
+
+//      Record fields per source:
+//          TELEMETRY_PID   E, Up, Ui, Ud and Ut of the sample
+//          TELEMETRY_LEAD  E and Ut of the sample (Up, Ui, Ud = 0)
+//          TELEMETRY_LQR   E of state 0 and Ut of the sample (Up, Ui, Ud = 0)
+
+//      Records from several controllers are told apart by the Id set with SetTelemetryId.
+//      When a ring is full new records are dropped and counted (see GetDropped).
+
+//      Each ring has a single producer. Controllers may run in ISRs of different priorities
+//      (cascades, ControllerSlot), and a preempting Push on the same ring could take the slot being
+//      filled. There are TELEMETRY_CHANNELS rings instead, one per ISR priority: SetTelemetryId
+//      selects the ring of each controller, and all controllers on one ring must run at the same
+//      priority (they never preempt each other). Drain empties the rings in channel order, so the
+//      records of one channel stay in order; use Seq and Id to merge the channels.
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef TELEMETRY_TIVAC_H_
+#define TELEMETRY_TIVAC_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// SPSC ring buffer
+#include "Ring_TivaC.hpp"
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Telemetry switch - 0: Disabled (no code generated), 1: Enabled
+#ifndef TELEMETRY_ENABLE
+#define TELEMETRY_ENABLE 0
+#endif
+
+// Ring size (records, power of two)
+#ifndef TELEMETRY_SIZE
+#define TELEMETRY_SIZE 256
+#endif
+
+// Number of rings - One per ISR priority running controllers
+#ifndef TELEMETRY_CHANNELS
+#define TELEMETRY_CHANNELS 1
+#endif
+
+// Telemetry tap
+#if TELEMETRY_ENABLE
+#define TELEMETRY_PUSH(Channel, Source, Id, Saturated, E, Up, Ui, Ud, Ut) \
+    Telemetry::Push(Channel, Source, Id, Saturated, E, Up, Ui, Ud, Ut)
+#else
+#define TELEMETRY_PUSH(Channel, Source, Id, Saturated, E, Up, Ui, Ud, Ut)
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Program enumerations
+// ------------------------------------------------------------------------------------------------------- //
+
+// Record source
+typedef enum
+{
+    TELEMETRY_PID = 0,
+    TELEMETRY_LEAD,
+    TELEMETRY_LQR,
+} telemetry_source_t;
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// Telemetry record - 24 bytes
+typedef struct
+{
+    uint8_t Source;             // Record source (telemetry_source_t)
+    uint8_t Id;                 // Controller id (SetTelemetryId)
+    uint8_t Saturated;          // Output saturated in this sample
+    uint8_t Seq;                // Sequence number (wraps) - Gaps show dropped records
+    float E;                    // Error (sample k)
+    float Up;                   // Control action - Proportional portion
+    float Ui;                   // Control action - Integral portion
+    float Ud;                   // Control action - Derivative portion
+    float Ut;                   // Control action - Total (limited)
+} telemetry_t;
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototype
+// ------------------------------------------------------------------------------------------------------- //
+
+class Telemetry
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+#if TELEMETRY_ENABLE
+        // Record rings - One producer each
+        static SpscRing<telemetry_t, TELEMETRY_SIZE> _Rings[TELEMETRY_CHANNELS];
+
+        // Sequence number of the next record of each ring
+        static uint8_t _Seq[TELEMETRY_CHANNELS];
+#endif
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        Push
+        // Description: Pushes one record into a ring (producer side - control ISR of the channel)
+        //              Defined inline in this header so the tap costs only a few cycles
+        // Arguments:   Channel - Ring (0 to TELEMETRY_CHANNELS - 1)
+        //              Source - Record source (telemetry_source_t)
+        //              Id - Controller id
+        //              Saturated - Output saturated in this sample
+        //              E - Error
+        //              Up, Ui, Ud - Control action portions
+        //              Ut - Control action - Total
+        // Returns:     None
+        static void Push(uint8_t Channel, uint8_t Source, uint8_t Id, bool Saturated, float E, float Up, float Ui, float Ud, float Ut);
+
+        // Name:        Drain
+        // Description: Removes up to Max records from the rings, in channel order (consumer side - main loop)
+        // Arguments:   Buffer - Buffer to receive the records
+        //              Max - Buffer size (records)
+        // Returns:     Number of records removed
+        static uint32_t Drain(telemetry_t *Buffer, uint32_t Max);
+
+        // Name:        GetCount
+        // Description: Gets the number of records waiting in all rings
+        // Arguments:   None
+        // Returns:     Number of records
+        static uint32_t GetCount();
+
+        // Name:        GetDropped
+        // Description: Gets the number of records dropped because a ring was full
+        // Arguments:   None
+        // Returns:     Number of dropped records
+        static uint32_t GetDropped();
+
+        // Name:        Clear
+        // Description: Discards all records waiting in the rings (consumer side)
+        // Arguments:   None
+        // Returns:     None
+        static void Clear();
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Inline functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+inline void Telemetry::Push(uint8_t Channel, uint8_t Source, uint8_t Id, bool Saturated, float E, float Up, float Ui, float Ud, float Ut)
+{
+#if TELEMETRY_ENABLE
+    // Single producer per ring - Claim, fill and publish the slot without locking
+    telemetry_t *Slot = _Rings[Channel].Reserve();
+
+    // Ring full - Dropped
+    if (Slot == nullptr)
+    {
+        _Seq[Channel]++;
+        return;
+    }
+
+    Slot->Source = Source;
+    Slot->Id = Id;
+    Slot->Saturated = Saturated;
+    Slot->Seq = _Seq[Channel]++;
+    Slot->E = E;
+    Slot->Up = Up;
+    Slot->Ui = Ui;
+    Slot->Ud = Ud;
+    Slot->Ut = Ut;
+
+    _Rings[Channel].Commit();
+#else
+    (void)Channel;
+    (void)Source;
+    (void)Id;
+    (void)Saturated;
+    (void)E;
+    (void)Up;
+    (void)Ui;
+    (void)Ud;
+    (void)Ut;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
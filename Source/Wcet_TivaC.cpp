@@ -0,0 +1,116 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Execution time measurement library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Execution time measurement defines and macros
+#include "Wcet_TivaC.hpp"
+
+// Standard libraries
+#include <stdint.h>
+
+// Host monotonic clock
+#if defined(WCET_SOURCE_CLOCK)
+#include <time.h>
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Static members
+// ------------------------------------------------------------------------------------------------------- //
+
+wcet_stats_t Wcet::_Stats[WCET_SITES];
+
+// ------------------------------------------------------------------------------------------------------- //
+// Functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#if defined(WCET_SOURCE_CLOCK)
+
+// Name:        WcetClockNs
+// Description: Reads the host monotonic clock
+// Arguments:   None
+// Returns:     Time in ns (wraps around)
+
+uint32_t WcetClockNs()
+{
+    struct timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return (uint32_t)((uint64_t)Now.tv_sec * 1000000000ULL + (uint64_t)Now.tv_nsec);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#endif
+
+// Name:        Init
+// Description: Enables the cycle counter and clears all statistics
+// Arguments:   None
+// Returns:     None
+
+void Wcet::Init()
+{
+#if defined(WCET_SOURCE_DWT)
+    // Enable the trace unit, then the cycle counter
+    WCET_DEMCR |= WCET_DEMCR_TRCENA;
+    WCET_DWT_CYCCNT = 0;
+    WCET_DWT_CTRL |= WCET_DWT_CYCCNTENA;
+#endif
+
+    for (uint8_t Site = 0; Site < WCET_SITES; Site++)
+        Reset((wcet_site_t)Site);
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetStats
+// Description: Gets the statistics of a site
+// Arguments:   Site - Measurement site
+//              Stats - wcet_stats_t struct to receive the data
+// Returns:     None
+
+void Wcet::GetStats(wcet_site_t Site, wcet_stats_t *Stats)
+{
+    if (Site < WCET_SITES)
+        *Stats = _Stats[Site];
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        GetMean
+// Description: Gets the mean execution time of a site
+// Arguments:   Site - Measurement site
+// Returns:     Mean (cycles), 0 if the site was not measured
+
+float Wcet::GetMean(wcet_site_t Site)
+{
+    if ((Site >= WCET_SITES) || (_Stats[Site].Count == 0))
+        return 0;
+
+    return (float)_Stats[Site].Sum / (float)_Stats[Site].Count;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+// Name:        Reset
+// Description: Clears the statistics of a site
+// Arguments:   Site - Measurement site
+// Returns:     None
+
+void Wcet::Reset(wcet_site_t Site)
+{
+    const wcet_stats_t Default = wcet_stats_t_default;
+
+    if (Site < WCET_SITES)
+        _Stats[Site] = Default;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
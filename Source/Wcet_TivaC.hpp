@@ -0,0 +1,291 @@
+// ------------------------------------------------------------------------------------------------------- //
+
+// Execution time measurement library
+// Version: 1.0
+// Author: Renan Duarte
+// E-mail: duarte.renan@hotmail.com
+// Date:   16/10/2026
+
+// Overview:
+
+//      Measures the execution time of the library hot paths in cycles:
+//          WCET_PID            Pid::Compute
+//          WCET_LEAD           Lead::Compute
+//          WCET_LQR            Lqr::Compute
+//          WCET_STEPPER_VEL    Stepper::_CalculateVel
+//          WCET_RGB_FADE       Rgb::_FadeService
+
+//      Each site keeps the number of calls, minimum, maximum and sum of the cycle counts, plus a log2
+//      histogram (bin N counts calls that took 2^N to 2^(N+1) - 1 cycles). Read them with
+//      Wcet::GetStats and Wcet::GetMean.
+
+//      Cycle source:
+//          Target (Cortex-M4)  DWT cycle counter (CYCCNT), enabled by Wcet::Init
+//          Host (x86)          Time stamp counter (rdtsc)
+//          Other hosts         Monotonic clock (ns)
+
+//      The instrumentation is a compile-time switch. Define WCET_ENABLE as 1 in the project options to
+//      enable it. With WCET_ENABLE = 0 (default) WCET_SCOPE expands to nothing and the hot paths are not
+//      changed. Wcet::GetCycles is always available as a timestamp source.
+
+//      Usage example:
+//          Wcet::Init();
+//          ...
+//          wcet_stats_t Stats;
+//          Wcet::GetStats(WCET_PID, &Stats);
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifndef WCET_TIVAC_H_
+#define WCET_TIVAC_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Includes
+// ------------------------------------------------------------------------------------------------------- //
+
+// Standard libraries
+#include <stdint.h>
+
+// ------------------------------------------------------------------------------------------------------- //
+// Definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+// Instrumentation switch - 0: Disabled (no code generated), 1: Enabled
+#ifndef WCET_ENABLE
+#define WCET_ENABLE 0
+#endif
+
+// Number of histogram bins (log2 of the cycle count)
+#define WCET_BINS 32
+
+// Cycle source
+#if defined(__arm__) || defined(__TI_ARM__) || defined(__TI_COMPILER_VERSION__)
+#define WCET_SOURCE_DWT
+#elif defined(__x86_64__) || defined(__i386__)
+#define WCET_SOURCE_TSC
+#else
+#define WCET_SOURCE_CLOCK
+#endif
+
+// DWT registers (Cortex-M4)
+#define WCET_DWT_CTRL   (*((volatile uint32_t *)0xE0001000))    // DWT control
+#define WCET_DWT_CYCCNT (*((volatile uint32_t *)0xE0001004))    // DWT cycle counter
+#define WCET_DEMCR      (*((volatile uint32_t *)0xE000EDFC))    // Debug exception and monitor control
+#define WCET_DEMCR_TRCENA 0x01000000                            // DEMCR - Trace enable
+#define WCET_DWT_CYCCNTENA 0x00000001                           // DWT_CTRL - Cycle counter enable
+
+// Measurement scope - Measures from this line to the end of the enclosing block
+#if WCET_ENABLE
+#define WCET_SCOPE(Site) WcetScope _WcetScope(Site)
+#else
+#define WCET_SCOPE(Site)
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+// Program enumerations
+// ------------------------------------------------------------------------------------------------------- //
+
+// Measurement sites
+typedef enum
+{
+    WCET_PID = 0,
+    WCET_LEAD,
+    WCET_LQR,
+    WCET_STEPPER_VEL,
+    WCET_RGB_FADE,
+    WCET_SITES,                 // Number of sites
+} wcet_site_t;
+
+// ------------------------------------------------------------------------------------------------------- //
+// Structs
+// ------------------------------------------------------------------------------------------------------- //
+
+// Execution time statistics of one site
+typedef struct
+{
+    uint32_t Count;             // Number of measured calls
+    uint32_t Min;               // Minimum (cycles)
+    uint32_t Max;               // Maximum (cycles)
+    uint64_t Sum;               // Sum (cycles)
+    uint32_t Hist[WCET_BINS];   // Histogram - Bin N: 2^N to 2^(N+1) - 1 cycles
+} wcet_stats_t;
+
+// Execution time statistics - Default values
+#define wcet_stats_t_default { \
+    .Count = 0, \
+    .Min = 0xFFFFFFFF, \
+    .Max = 0, \
+    .Sum = 0, \
+    .Hist = {0}, \
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+// Class prototypes
+// ------------------------------------------------------------------------------------------------------- //
+
+class Wcet
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        // Statistics of every site
+        static wcet_stats_t _Stats[WCET_SITES];
+
+        // Name:        _Log2
+        // Description: Gets the integer base 2 logarithm
+        // Arguments:   Value - Input value
+        // Returns:     floor(log2(Value)), 0 for Value = 0
+        static uint8_t _Log2(uint32_t Value);
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        Init
+        // Description: Enables the cycle counter and clears all statistics
+        // Arguments:   None
+        // Returns:     None
+        static void Init();
+
+        // Name:        GetCycles
+        // Description: Reads the cycle counter (defined inline in this header)
+        // Arguments:   None
+        // Returns:     Cycle count (wraps around)
+        static uint32_t GetCycles();
+
+        // Name:        Record
+        // Description: Adds one measurement to a site (defined inline in this header)
+        // Arguments:   Site - Measurement site
+        //              Cycles - Measured cycles
+        // Returns:     None
+        static void Record(wcet_site_t Site, uint32_t Cycles);
+
+        // Name:        GetStats
+        // Description: Gets the statistics of a site
+        // Arguments:   Site - Measurement site
+        //              Stats - wcet_stats_t struct to receive the data
+        // Returns:     None
+        static void GetStats(wcet_site_t Site, wcet_stats_t *Stats);
+
+        // Name:        GetMean
+        // Description: Gets the mean execution time of a site
+        // Arguments:   Site - Measurement site
+        // Returns:     Mean (cycles), 0 if the site was not measured
+        static float GetMean(wcet_site_t Site);
+
+        // Name:        Reset
+        // Description: Clears the statistics of a site
+        // Arguments:   Site - Measurement site
+        // Returns:     None
+        static void Reset(wcet_site_t Site);
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+
+class WcetScope
+{
+    // --------------------------------------------------------------------------------------------------- //
+    // Private members
+    // --------------------------------------------------------------------------------------------------- //
+
+    private:
+
+        wcet_site_t _Site;          // Measurement site
+        uint32_t _Start;            // Cycle count at the start of the scope
+
+    // --------------------------------------------------------------------------------------------------- //
+    // Public members
+    // --------------------------------------------------------------------------------------------------- //
+
+    public:
+
+        // Name:        WcetScope
+        // Description: Starts the measurement
+        // Arguments:   Site - Measurement site
+        // Returns:     None
+        WcetScope(wcet_site_t Site) : _Site(Site), _Start(Wcet::GetCycles()) {}
+
+        // Name:        ~WcetScope
+        // Description: Ends the measurement and records it
+        // Arguments:   None
+        // Returns:     None
+        ~WcetScope() { Wcet::Record(_Site, Wcet::GetCycles() - _Start); }
+};
+
+// ------------------------------------------------------------------------------------------------------- //
+// Inline functions definitions
+// ------------------------------------------------------------------------------------------------------- //
+
+#if defined(WCET_SOURCE_CLOCK)
+
+// Monotonic clock (ns) - Defined in Wcet_TivaC.cpp
+uint32_t WcetClockNs();
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //
+
+inline uint32_t Wcet::GetCycles()
+{
+#if defined(WCET_SOURCE_DWT)
+    return WCET_DWT_CYCCNT;
+#elif defined(WCET_SOURCE_TSC)
+    return (uint32_t)__builtin_ia32_rdtsc();
+#else
+    return WcetClockNs();
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+inline uint8_t Wcet::_Log2(uint32_t Value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (Value != 0) ? (uint8_t)(31 - __builtin_clz(Value)) : 0;
+#else
+    uint8_t Bit = 0;
+
+    while (Value >>= 1)
+        Bit++;
+
+    return Bit;
+#endif
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+inline void Wcet::Record(wcet_site_t Site, uint32_t Cycles)
+{
+    wcet_stats_t *Stats = &_Stats[Site];
+
+    Stats->Count++;
+    Stats->Sum += Cycles;
+
+    if (Cycles < Stats->Min)
+        Stats->Min = Cycles;
+
+    if (Cycles > Stats->Max)
+        Stats->Max = Cycles;
+
+    Stats->Hist[_Log2(Cycles)]++;
+}
+
+// ------------------------------------------------------------------------------------------------------- //
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------- //